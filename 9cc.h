@@ -1,241 +1,693 @@
-#include <ctype.h>
-#include <stdarg.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <stdbool.h>
-#include <string.h>
-#include <assert.h>
-#include <errno.h>
-
-
-typedef struct Type Type;
-typedef struct Member Member;
-
-
-
-
-// kinds of tokens
-typedef enum {
-    TK_RESERVED,    // symbol
-    TK_IDENT,       // identifier
-    TK_STR,         // string Token
-    TK_NUM,         // Integer Token
-    TK_EOF,         // Token of End Of File
-
-} TokenKind;
-
-typedef struct Token Token;
-
-
-struct Token {
-    TokenKind kind; // kind of token
-    Token *next;    // next input token
-    long val;        // the value of token when the kind is TK_NUM
-    char *str;      // token string
-    int len;        // length of token
-
-    char *contents; // contents of string token including '\0'
-    char cont_len;  //length of contents of string token
-};
-
-void error(char *fmt, ...);
-void error_at(char *loc, char *fmt, ...);
-void error_tok(Token *tok, char *fmt, ...);
-
-Token *peek(char *s);
-Token *consume(char *s);
-Token *consume_ident(void);
-void expect(char *op);
-long expect_number(void);
-char *expect_ident(void);
-bool at_eof(void);
-Token *new_token(TokenKind kind, Token *cur, char *str, int len);
-Token *tokenize(char *p);
-
-extern char *filename;
-extern char *user_input;
-extern Token *token;
-typedef struct Var Var;
-
-struct Var {
-    char *name;     // the name of local variable
-    int offset;     // the offset from RBP
-    Type *ty;
-
-    bool is_local;  // local or global
-
-    char *contents;
-    int cont_len;
-};
-
-// Local variable
-
-
-typedef struct VarList VarList;
-
-struct VarList {
-    VarList *next;
-    Var *var;
-};
-
-// Kinds of node of abstruct syntax tree (AST)
-typedef enum {
-    ND_ADD,     // +
-    ND_SUB,     // -
-    ND_MUL,     // *
-    ND_DIV,     // /
-    ND_EQ,      // ==
-    ND_NE,      // !=
-    ND_LT,      // <
-    ND_LE,      // <=
-    ND_ASSIGN,  // =
-    ND_MEMBER,  // . (struct member access)
-    ND_NUM,     // Integer
-    ND_VAR,    // local one letter variable
-    ND_RETURN,  // return
-    ND_IF,      // if
-    ND_ELSE,    // else
-    ND_WHILE,   // while
-    ND_FOR,     // for
-    ND_BLOCK,   // {...}
-    ND_FUNCALL, // Function call
-    ND_EXPR_STMT, // Expression statement
-    ND_STMT_EXPR, // Statement expression
-    ND_ADDR,    // unary &
-    ND_DEREF,   // unary *
-    ND_NULL,    // Empty statement
-    ND_SIZEOF,  // sizeof
-} NodeKind;
-
-typedef struct Node Node;
-
-// type of node of AST
-struct Node {
-    NodeKind kind;  // type of the node
-    Node *next;     // next node
-    Node *lhs;      // left-hand side of the node
-    Node *rhs;      // right-hand side of the node
-    long val;        // use only if kind is ND_NUM
-    int offset;     // use only if kind is ND_VAR
-    Var *var;
-    Token *tok;
-
-    // "if" ( cond ) then "else" els
-    // "for" ( init; cond; inc ) body
-    // "while" ( cond ) body
-    Node *cond;
-    Node *then;
-    Node *els;
-    Node *init;
-    Node *inc;
-
-     // Block or statement expression
-    Node *body;
-
-    // Struct member access
-    char *member_name;
-    Member *member;
-
-    // Function call
-    char *funcname;
-    Node *args;
-
-    Type *ty;
-};
-
-typedef struct  Function Function;
-
-struct Function {
-    Function *next;
-    char *name;
-    VarList *params;
-    Node *node;
-    VarList *locals;
-    int stack_size;
-};
-
-typedef struct {
-    VarList *globals;
-    Function *fns;
-} Program;
-
-Program *program();
-
-
-typedef enum {
-    TY_VOID,
-    TY_BOOL,
-    TY_SHORT,
-    TY_INT,
-    TY_LONG,
-    TY_CHAR,
-    TY_PTR,
-    TY_ARRAY,
-    TY_STRUCT,
-    TY_FUNC,
-} TypeKind;
-
-struct Type
-{
-    TypeKind kind;
-    bool is_typedef;    // typedef
-    int align;          // alignment
-    Type *base;         // pointer or array
-    size_t array_size;  // array
-    Member *members;    // struct
-    Type *return_ty;    // function
-};
-
-// struct member
-struct Member {
-    Member *next;
-    Type *ty;
-    char *name;
-    int offset;
-};
-
-int align_to(int n, int align);
-Type *void_type(void);
-Type *bool_type(void);
-Type *short_type(void);
-Type *int_type(void);
-Type *long_type(void);
-Type *char_type(void);
-Type *func_type(Type *return_ty);
-Type *pointer_to(Type *base);
-Type *array_of(Type *base, int size);
-int size_of(Type *ty);
-void add_type(Program *prog);
-
-
-// codegen.c
-void gen(Node *node);
-void codegen(Program *prog);
-
-
-extern Function *prog;
-
-extern VarList *locals;
-
-typedef struct 
-{
-    void **data;
-    int capacity;
-    int len;
-} Vector;
-
-Vector *new_vec(void);
-void vec_push(Vector *v, void *elem);
-
-typedef struct 
-{
-    Vector *keys;
-    Vector *vals;
-} Map;
-
-Map *new_map(void);
-void map_put(Map *map, char *key, void *val);
-void *map_get(Map *map, char *key);
-
-
-char *strndup(char *str, int chars);
\ No newline at end of file
+#define _DEFAULT_SOURCE
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <setjmp.h>
+
+
+typedef struct Type Type;
+typedef struct Member Member;
+
+
+
+
+// kinds of tokens
+typedef enum {
+    TK_RESERVED,    // symbol
+    TK_IDENT,       // identifier
+    TK_STR,         // string Token
+    TK_NUM,         // Integer Token
+    TK_EOF,         // Token of End Of File
+
+} TokenKind;
+
+// Keywords and punctuators. The tokenizer classifies a TK_RESERVED
+// token once and the parser only compares these ids.
+typedef enum {
+    KW_RETURN,
+    KW_IF,
+    KW_ELSE,
+    KW_WHILE,
+    KW_FOR,
+    KW_SHORT,
+    KW_INT,
+    KW_LONG,
+    KW_SIZEOF,
+    KW_CHAR,
+    KW_STRUCT,
+    KW_TYPEDEF,
+    KW_VOID,
+    KW_BOOL,        // _Bool
+    PU_EQ,          // ==
+    PU_NE,          // !=
+    PU_LE,          // <=
+    PU_GE,          // >=
+    PU_ARROW,       // ->
+    PU_PLUS,        // +
+    PU_MINUS,       // -
+    PU_STAR,        // *
+    PU_SLASH,       // /
+    PU_LPAREN,      // (
+    PU_RPAREN,      // )
+    PU_LT,          // <
+    PU_GT,          // >
+    PU_ASSIGN,      // =
+    PU_SEMI,        // ;
+    PU_LBRACE,      // {
+    PU_RBRACE,      // }
+    PU_COMMA,       // ,
+    PU_AMP,         // &
+    PU_LBRACKET,    // [
+    PU_RBRACKET,    // ]
+    PU_DOT,         // .
+    NUM_RESERVED,
+} Reserved;
+
+typedef struct Token Token;
+
+
+struct Token {
+    TokenKind kind; // kind of token
+    Reserved id;    // keyword or punctuator when the kind is TK_RESERVED
+    long val;       // the value of token when the kind is TK_NUM,
+                    // index into str_lits when the kind is TK_STR
+    char *str;      // token string
+    int len;        // length of token
+
+    char *name;     // interned spelling when the kind is TK_IDENT
+    unsigned hash;  // hash of the spelling when the kind is TK_IDENT
+};
+
+// Contents of a string literal, kept out of the token array.
+typedef struct {
+    char *contents; // contents of string token including '\0'
+    int len;        // length of contents
+} StrLit;
+
+extern _Thread_local jmp_buf *error_jmp;
+
+_Noreturn void die(void);
+_Noreturn void error(char *fmt, ...);
+_Noreturn void error_at(char *loc, char *fmt, ...);
+_Noreturn void error_tok(Token *tok, char *fmt, ...);
+
+Token *peek(Reserved id);
+Token *consume(Reserved id);
+Token *consume_ident(void);
+void expect(Reserved id);
+long expect_number(void);
+char *expect_ident(void);
+bool at_eof(void);
+Token *new_token(TokenKind kind, char *str, int len);
+Token *tokenize(char *p);
+
+extern char *filename;
+extern char *user_input;
+extern Token *tokens;
+extern int pos;
+extern StrLit *str_lits;
+typedef struct Var Var;
+typedef struct IrInst IrInst;
+typedef struct Function Function;
+
+struct Var {
+    char *name;     // the name of local variable
+    int offset;     // the offset from RBP
+    Type *ty;
+
+    bool is_local;  // local or global
+    IrInst *ir;     // address in the IR of the function being lowered
+    Function *fn;   // the definition, if this names a defined function
+    int refs;       // nodes that refer to a local, counted by dce.c
+    int stores;     // how many of them are "x = e;" statements
+
+    char *contents;
+    int cont_len;
+};
+
+// Local variable
+
+
+typedef struct VarList VarList;
+
+struct VarList {
+    VarList *next;
+    Var *var;
+};
+
+// Kinds of node of abstruct syntax tree (AST)
+typedef enum {
+    ND_ADD,     // +
+    ND_SUB,     // -
+    ND_MUL,     // *
+    ND_DIV,     // /
+    ND_EQ,      // ==
+    ND_NE,      // !=
+    ND_LT,      // <
+    ND_LE,      // <=
+    ND_ASSIGN,  // =
+    ND_MEMBER,  // . (struct member access)
+    ND_NUM,     // Integer
+    ND_VAR,    // local one letter variable
+    ND_RETURN,  // return
+    ND_IF,      // if
+    ND_ELSE,    // else
+    ND_WHILE,   // while
+    ND_FOR,     // for
+    ND_BLOCK,   // {...}
+    ND_FUNCALL, // Function call
+    ND_EXPR_STMT, // Expression statement
+    ND_STMT_EXPR, // Statement expression
+    ND_ADDR,    // unary &
+    ND_DEREF,   // unary *
+    ND_NULL,    // Empty statement
+    ND_SIZEOF,  // sizeof
+    ND_GOTO,    // jump to label number val, made by the inliner
+    ND_LABEL,   // label number val
+} NodeKind;
+
+typedef struct Node Node;
+
+// type of node of AST
+struct Node {
+    NodeKind kind;  // type of the node
+    Node *next;     // next node
+    Node *lhs;      // left-hand side of the node
+    Node *rhs;      // right-hand side of the node
+    long val;        // use only if kind is ND_NUM
+    int offset;     // use only if kind is ND_VAR
+    Var *var;
+    Token *tok;
+
+    // "if" ( cond ) then "else" els
+    // "for" ( init; cond; inc ) body
+    // "while" ( cond ) body
+    Node *cond;
+    Node *then;
+    Node *els;
+    Node *init;
+    Node *inc;
+
+     // Block or statement expression
+    Node *body;
+
+    // Struct member access
+    char *member_name;
+    Member *member;
+
+    // Function call
+    char *funcname;
+    Node *args;
+    bool has_prototype; // the callee was declared before the call
+
+    Type *ty;
+};
+
+struct Function {
+    Function *next;
+    char *name;
+    VarList *params;
+    Node *node;
+    VarList *locals;
+    VarList *literals;  // string literals used by the function
+    int stack_size;
+    int num_tokens;     // for -ftime-report
+    long num_nodes;
+    int num_labels;     // ND_LABELs in the body
+    int num_calls;      // call sites in the program, for the inliner
+
+    uint64_t cache_key;
+    char *cached;       // assembly from the cache, or NULL
+    long cached_len;
+};
+
+typedef struct {
+    VarList *globals;
+    Function *fns;
+} Program;
+
+Program *program();
+void reset_parser(void);
+Node *new_node(NodeKind kind, Token *tok);
+Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok);
+Node *new_unary(NodeKind kind, Node *expr, Token *tok);
+Node *new_node_num(long val, Token *tok);
+Node *new_node_Var(Var *var, Token *tok);
+
+
+typedef enum {
+    TY_VOID,
+    TY_BOOL,
+    TY_SHORT,
+    TY_INT,
+    TY_LONG,
+    TY_CHAR,
+    TY_PTR,
+    TY_ARRAY,
+    TY_STRUCT,
+    TY_FUNC,
+} TypeKind;
+
+struct Type
+{
+    TypeKind kind;
+    bool is_typedef;    // typedef
+    int align;          // alignment
+    Type *base;         // pointer or array
+    size_t array_size;  // array
+    Member *members;    // struct
+    Type *return_ty;    // function
+};
+
+// struct member
+struct Member {
+    Member *next;
+    Type *ty;
+    char *name;
+    int offset;
+};
+
+int align_to(int n, int align);
+Type *new_type(TypeKind kind, int align);
+Type *void_type(void);
+Type *bool_type(void);
+Type *short_type(void);
+Type *int_type(void);
+Type *long_type(void);
+Type *char_type(void);
+Type *func_type(Type *return_ty);
+Type *pointer_to(Type *base);
+Type *array_of(Type *base, int size);
+int size_of(Type *ty);
+void add_type(Function *fn);
+
+// fold.c
+bool has_side_effects(Node *node);
+void fold(Function *fn);
+
+// dce.c
+void eliminate_dead_code(Function *fn);
+void dce_report(FILE *fp);
+void reset_dce(void);
+
+// inline.c
+void inline_functions(Program *prog);
+uint64_t inline_key(Function *fn);
+
+// ir.c
+//
+// Mid-level IR. A function is a list of basic blocks of instructions
+// in SSA form: every instruction that produces a value defines the
+// virtual register %id, and values that meet at a join are merged by
+// phis at the start of the block. Values are 64-bit integers or
+// pointers. Memory is only touched by IR_LOAD, which sign-extends, and
+// IR_STORE, which truncates, both `size` bytes wide.
+typedef enum {
+    IR_CONST,   // imm
+    IR_PARAM,   // argument number imm
+    IR_ALLOCA,  // address of local variable `var`
+    IR_GLOBAL,  // address of global `name`
+    IR_LOAD,    // *args[0]
+    IR_STORE,   // *args[0] = args[1]
+    IR_ADD,
+    IR_SUB,
+    IR_MUL,
+    IR_DIV,
+    IR_EQ,
+    IR_NE,
+    IR_LT,
+    IR_LE,
+    IR_SEXT,    // args[0] truncated to `size` bytes and sign-extended
+    IR_CALL,    // name(args...)
+    IR_PHI,     // args[i] when coming from block->preds[i]
+    IR_JMP,     // to succs[0]
+    IR_BR,      // to succs[0] if args[0] != 0, else to succs[1]
+    IR_RET,     // return args[0]
+} IrOp;
+
+typedef enum {
+    IT_VOID,
+    IT_I64,
+    IT_PTR,
+} IrType;
+
+typedef struct Block Block;
+
+struct IrInst {
+    IrOp op;
+    IrType ty;
+    int id;
+    IrInst **args;
+    int num_args;
+    long imm;
+    int size;       // IR_LOAD, IR_STORE and IR_SEXT
+    char *name;     // IR_GLOBAL and IR_CALL
+    bool variadic;  // IR_CALL to a callee that may be variadic
+    Var *var;       // IR_ALLOCA
+    Block *block;   // NULL once removed
+    IrInst *prev;
+    IrInst *next;
+
+    IrInst *replaced;   // value that took the place of a removed instruction
+    int num_uses;
+    int slot;           // frame offset assigned by isel
+};
+
+struct Block {
+    Block *next;
+    int id;
+    IrInst *first;
+    IrInst *last;   // the terminator once the block is complete
+    Block **preds;
+    int num_preds;
+    Block *succs[2];
+    int num_succs;
+    bool is_loop;   // loop header, aligned by isel
+
+    Block *idom;    // immediate dominator, NULL for the entry
+    int depth;      // depth in the dominator tree
+};
+
+typedef struct {
+    Function *fn;
+    Block *blocks;  // in layout order, entry first
+    int num_blocks;
+    int num_values;
+} IrFunc;
+
+IrType ir_type(Type *ty);
+void *ir_grow(void *arr, int len, int size);
+bool is_terminator(IrOp op);
+IrFunc *lower(Function *fn);
+IrInst *new_inst(IrFunc *f, IrOp op, IrType ty);
+void insert_before(IrInst *pos, IrInst *inst);
+void remove_inst(IrInst *inst);
+IrInst *resolve(IrInst *v);
+void count_uses(IrFunc *f);
+void verify_ir(IrFunc *f, char *pass);
+void dump_ir(IrFunc *f, FILE *fp);
+
+// ssa.c
+void compute_dominators(IrFunc *f);
+bool dominates(Block *a, Block *b);
+void mem2reg(IrFunc *f);
+
+// isel.c
+void isel(IrFunc *f);
+
+
+// main.c
+extern bool opt_mem_report;
+extern bool opt_fold;
+extern int opt_jobs;
+extern char *opt_cache;
+extern bool opt_cache_report;
+extern bool opt_time_report;
+extern char *opt_trace;
+extern bool opt_ssa;
+extern bool opt_dump_ir;
+extern bool opt_peephole;
+extern bool opt_peephole_report;
+extern int opt_align_loops;
+extern bool opt_omit_frame_pointer;
+extern int opt_inline_limit;
+extern bool opt_dce;
+extern bool opt_dce_report;
+
+void compile(int argc, char **argv);
+void reset_compiler(void);
+
+// cache.c
+uint64_t hash64(uint64_t h, void *data, long len);
+uint64_t hash_type(uint64_t h, Type *ty);
+void cache_init(void);
+uint64_t cache_seed(void);
+char *cache_lookup(uint64_t key, long *len);
+void cache_store(uint64_t key, char *text, long len);
+void cache_report(FILE *fp);
+
+// report.c
+typedef enum {
+    PH_READ,
+    PH_TOKENIZE,
+    PH_PARSE,
+    PH_INLINE,
+    PH_TYPE,        // per function from here to PH_PEEPHOLE
+    PH_FOLD,
+    PH_DCE,
+    PH_LAYOUT,
+    PH_IR,
+    PH_GEN,
+    PH_PEEPHOLE,
+    PH_WRITE,
+    NUM_PHASES,
+} Phase;
+
+// Objects created by the calling thread.
+typedef struct {
+    long nodes;
+    long types;
+    long insts;
+    long bytes;     // of assembly text, or of machine code with -c
+} Counters;
+
+// Start of a timed region.
+typedef struct {
+    long time;
+    Counters counters;
+} Mark;
+
+extern bool timing;
+extern _Thread_local Counters counters;
+
+long peak_rss(void);
+void report_init(void);
+Mark mark(void);
+void phase_end(Phase ph, Mark *m);
+void function_end(Function *fn, Mark *m);
+void report_tokens(long n);
+void report_output(long n);
+void time_report(FILE *fp);
+void write_trace(char *path);
+
+// server.c
+void run_server(char *path);
+
+// arena.c
+//
+// Arenas are per thread, so allocation needs no locking. Worker
+// threads hand theirs over with arena_thread_exit().
+typedef struct ArenaBlock ArenaBlock;
+
+typedef struct {
+    char *name;
+    ArenaBlock *blocks; // blocks, newest first
+    char *cur;          // next free byte of the newest block
+    char *end;
+    size_t objects;     // number of allocations
+    size_t bytes;       // bytes handed out
+    size_t reserved;    // bytes obtained from malloc
+} Arena;
+
+extern _Thread_local Arena token_arena;   // tokens and string literal contents
+extern _Thread_local Arena node_arena;    // AST, variables, scopes and functions
+extern _Thread_local Arena type_arena;    // types and struct members
+extern _Thread_local Arena string_arena;  // interned identifiers
+extern _Thread_local Arena ir_arena;      // IR of the functions being compiled
+
+void *arena_alloc(Arena *arena, size_t size);
+char *arena_strndup(Arena *arena, char *str, int len);
+void arena_release(Arena *arena);
+void arena_thread_exit(void);
+void arena_reset(void);
+void arena_report(FILE *fp);
+
+// codegen.c
+void gen(Node *node);
+void codegen(Program *prog);
+
+
+extern Function *prog;
+
+extern VarList *locals;
+
+typedef struct 
+{
+    void **data;
+    int capacity;
+    int len;
+} Vector;
+
+Vector *new_vec(void);
+void vec_push(Vector *v, void *elem);
+
+typedef struct 
+{
+    Vector *keys;
+    Vector *vals;
+} Map;
+
+Map *new_map(void);
+void map_put(Map *map, char *key, void *val);
+void *map_get(Map *map, char *key);
+
+
+unsigned hash_str(char *str, int len);
+char *intern(char *str, int len, unsigned hash);
+unsigned name_hash(char *name);
+char *format(char *fmt, ...);
+
+// emit.c
+
+// x86-64 registers, numbered as in the instruction encoding.
+typedef enum {
+    REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+    REG_R8, REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15,
+    REG_RIP,    // base of RIP-relative memory operands
+    REG_NONE,
+} Reg;
+
+// Condition codes of jcc/setcc, numbered as in the encoding.
+// Flipping the lowest bit negates a condition.
+typedef enum {
+    CC_E = 0x4,
+    CC_NE = 0x5,
+    CC_L = 0xc,
+    CC_GE = 0xd,
+    CC_LE = 0xe,
+    CC_G = 0xf,
+} Cond;
+
+typedef enum {
+    // instructions
+    I_MOV,
+    I_MOVSX,
+    I_MOVSXD,
+    I_MOVZX,
+    I_LEA,
+    I_ADD,
+    I_SUB,
+    I_IMUL,
+    I_CQO,
+    I_IDIV,
+    I_NEG,
+    I_AND,
+    I_XOR,
+    I_SHL,
+    I_SHR,
+    I_SAR,
+    I_CMP,
+    I_SETCC,
+    I_JMP,
+    I_JCC,
+    I_CALL,
+    I_PUSH,
+    I_POP,
+    I_RET,
+    // directives
+    I_LABEL,
+    I_GLOBAL,
+    I_DATA,
+    I_TEXT,
+    I_ZERO,
+    I_BYTE,
+    I_ALIGN,
+} Op;
+
+typedef enum {
+    OPD_NONE,
+    OPD_REG,
+    OPD_IMM,
+    OPD_MEM,    // [base+index*scale+disp] or [rip+sym+disp]
+    OPD_LABEL,  // jump/call target or symbol: name followed by num if num >= 0
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    int size;       // width in bytes of a register or memory operand
+    Reg reg;        // register, or base register of a memory operand
+    Reg index;      // index register of a memory operand if scale is not 0
+    int scale;
+    long val;       // immediate, or displacement of a memory operand
+    char *name;     // label, or symbol of a RIP-relative memory operand
+    int num;        // label suffix
+} Operand;
+
+typedef struct {
+    Op op;
+    Cond cc;        // I_SETCC and I_JCC
+    Operand lhs;
+    Operand rhs;
+} Inst;
+
+extern char *outfile;
+extern bool emit_obj;
+
+Operand opd_reg(Reg reg, int size);
+Operand opd_imm(long val);
+Operand opd_mem(Reg base, long disp, int size);
+Operand opd_index(Reg base, Reg index, int scale, int size);
+Operand opd_sym(char *name, int size);
+Operand opd_label(char *name, int num);
+
+void emit_open(void);
+void emit_close(void);
+void emit0(Op op);
+void emit1(Op op, Operand lhs);
+void emit2(Op op, Operand lhs, Operand rhs);
+void emit_cc(Op op, Cond cc, Operand lhs);
+void emit_label(char *name, int num);
+void emit_raw(char *data, long len);
+
+// Output of one function generated on a worker thread. Assembly is
+// formatted into `text`; for object output the instructions are kept
+// and encoded later on the main thread.
+typedef struct {
+    char *text;
+    long len;
+    long cap;
+    Inst *insts;
+    int num_insts;
+    int cap_insts;
+} EmitBuffer;
+
+void emit_capture(EmitBuffer *buf);
+void emit_buffer(EmitBuffer *buf);
+void reset_emit(void);
+
+// Instructions held back by emit_hold() for the peephole optimizer.
+typedef struct {
+    Inst *insts;
+    int len;
+    int cap;
+} InstList;
+
+void emit_hold(InstList *list);
+void emit_held(InstList *list);
+
+// peep.c
+void peephole(InstList *list);
+void peephole_report(FILE *fp);
+void reset_peephole(void);
+
+// reduce.c
+void mul_imm(Reg rd, long c);
+void div_imm(Reg rd, long c);
+
+// elf.c
+void encode_inst(Inst *inst);
+void elf_write(void);
+void reset_elf(void);
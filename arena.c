@@ -0,0 +1,148 @@
+#include "9cc.h"
+
+// Bump-pointer allocators. Objects that live until the end of a
+// compilation (tokens, AST nodes, types) are carved out of large blocks
+// and are never freed one by one; a whole arena is released at once.
+
+#define ARENA_BLOCK_SIZE (256 * 1024)
+
+struct ArenaBlock {
+    ArenaBlock *next;
+    size_t size;
+    char data[];
+};
+
+_Thread_local Arena token_arena = {"token"};
+_Thread_local Arena node_arena = {"ast"};
+_Thread_local Arena type_arena = {"type"};
+_Thread_local Arena string_arena = {"string"};
+_Thread_local Arena ir_arena = {"ir"};
+
+#define NUM_ARENAS 5
+
+// Arenas of worker threads that have exited. Their blocks stay
+// allocated because the nodes and strings in them are still in use.
+static Arena retired[NUM_ARENAS];
+static pthread_mutex_t retired_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void new_block(Arena *arena, size_t size) {
+    if (size < ARENA_BLOCK_SIZE) {
+        size = ARENA_BLOCK_SIZE;
+    }
+    ArenaBlock *blk = malloc(sizeof(ArenaBlock) + size);
+    if (!blk) {
+        error("%s arena: out of memory", arena->name);
+    }
+    blk->next = arena->blocks;
+    blk->size = size;
+    arena->blocks = blk;
+    arena->cur = blk->data;
+    arena->end = blk->data + size;
+    arena->reserved += size;
+}
+
+// Returns zero-filled memory that stays valid until the arena is released.
+void *arena_alloc(Arena *arena, size_t size) {
+    size = align_to(size, 16);
+    if (arena->end - arena->cur < size) {
+        new_block(arena, size);
+    }
+    void *p = arena->cur;
+    arena->cur += size;
+    arena->bytes += size;
+    arena->objects++;
+    memset(p, 0, size);
+    return p;
+}
+
+char *arena_strndup(Arena *arena, char *str, int len) {
+    char *s = arena_alloc(arena, len + 1);
+    memcpy(s, str, len);
+    return s;
+}
+
+// Frees every block of the arena. Counters are cleared as well, so an
+// arena can be reused for the next translation unit.
+void arena_release(Arena *arena) {
+    ArenaBlock *blk = arena->blocks;
+    while (blk) {
+        ArenaBlock *next = blk->next;
+        free(blk);
+        blk = next;
+    }
+    arena->blocks = NULL;
+    arena->cur = arena->end = NULL;
+    arena->bytes = arena->objects = arena->reserved = 0;
+}
+
+// Moves the calling thread's blocks and counters to the retired list.
+void arena_thread_exit(void) {
+    Arena *arenas[] = {&token_arena, &node_arena, &type_arena, &string_arena, &ir_arena};
+
+    pthread_mutex_lock(&retired_lock);
+    for (int i = 0; i < NUM_ARENAS; i++) {
+        Arena *a = arenas[i];
+        Arena *r = &retired[i];
+        if (a->blocks) {
+            ArenaBlock *last = a->blocks;
+            while (last->next) {
+                last = last->next;
+            }
+            last->next = r->blocks;
+            r->blocks = a->blocks;
+        }
+        r->objects += a->objects;
+        r->bytes += a->bytes;
+        r->reserved += a->reserved;
+        a->blocks = NULL;
+        a->cur = a->end = NULL;
+        a->bytes = a->objects = a->reserved = 0;
+    }
+    pthread_mutex_unlock(&retired_lock);
+}
+
+// Rewinds the per-compile arenas of the calling thread for the next
+// job of the compile server. Each keeps its newest block, so the memory
+// stays mapped. Interned names in string_arena are kept as well, and
+// blocks handed over by worker threads are freed.
+void arena_reset(void) {
+    Arena *arenas[] = {&token_arena, &node_arena, &type_arena, &ir_arena};
+
+    for (int i = 0; i < sizeof(arenas) / sizeof(*arenas); i++) {
+        Arena *a = arenas[i];
+        ArenaBlock *keep = a->blocks;
+        if (!keep) {
+            continue;
+        }
+        a->blocks = keep->next;
+        arena_release(a);
+        keep->next = NULL;
+        a->blocks = keep;
+        a->cur = keep->data;
+        a->end = keep->data + keep->size;
+        a->reserved = keep->size;
+    }
+
+    pthread_mutex_lock(&retired_lock);
+    for (int i = 0; i < NUM_ARENAS; i++) {
+        arena_release(&retired[i]);
+    }
+    pthread_mutex_unlock(&retired_lock);
+}
+
+// Prints usage of the calling thread's arenas together with those of
+// retired worker threads.
+void arena_report(FILE *fp) {
+    Arena *arenas[] = {&token_arena, &node_arena, &type_arena, &string_arena, &ir_arena};
+
+    fprintf(fp, "%-8s %10s %12s %12s\n", "arena", "objects", "bytes", "reserved");
+    pthread_mutex_lock(&retired_lock);
+    for (int i = 0; i < NUM_ARENAS; i++) {
+        Arena *a = arenas[i];
+        Arena *r = &retired[i];
+        fprintf(fp, "%-8s %10zu %12zu %12zu\n", a->name, a->objects + r->objects,
+                a->bytes + r->bytes, a->reserved + r->reserved);
+    }
+    pthread_mutex_unlock(&retired_lock);
+    fprintf(fp, "peak RSS %ld KiB\n", peak_rss());
+}
@@ -0,0 +1,110 @@
+#!/bin/sh
+# Generated-code benchmark. Builds every kernel in bench/kernels with
+# 9cc and with gcc at each level in $LEVELS, checks that all builds exit
+# with the same status, and measures them. Cycles and instructions come
+# from `perf stat` when it is available; otherwise only wall time is
+# measured. Each measurement is the best of $RUNS runs. Results go to
+# stdout and, as JSON, to $OUT.
+set -e
+
+CC9=${CC9:-./9cc}
+CC=${CC:-gcc}
+OUT=${OUT:-bench-codegen.json}
+RUNS=${RUNS:-3}
+LEVELS=${LEVELS:-"0 1 2"}
+
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+
+if command -v perf > /dev/null && perf stat -e cycles true > /dev/null 2>&1; then
+    have_perf=1
+else
+    have_perf=
+    echo "perf is not available; measuring wall time only" >&2
+fi
+
+# Prints "ms cycles instructions" for the best of $RUNS runs of $1.
+# Cycles and instructions are "null" without perf.
+measure() {
+    best=
+    i=0
+    while [ $i -lt "$RUNS" ]; do
+        if [ -n "$have_perf" ]; then
+            perf stat -x, -e cycles,instructions -o "$dir/perf" "$1" > /dev/null || true
+            cycles=$(awk -F, '$3 ~ /^cycles/ { print $1 }' "$dir/perf")
+            insts=$(awk -F, '$3 ~ /^instructions/ { print $1 }' "$dir/perf")
+        else
+            cycles=null
+            insts=null
+        fi
+        start=$(date +%s%N)
+        "$1" > /dev/null || true
+        end=$(date +%s%N)
+        ms=$(( (end - start) / 1000 ))
+        ms=$(awk "BEGIN { printf \"%.3f\", $ms / 1000 }")
+        if [ -z "$best" ] || awk "BEGIN { exit !($ms < $best) }"; then
+            best=$ms
+            best_cycles=$cycles
+            best_insts=$insts
+        fi
+        i=$((i + 1))
+    done
+    echo "$best $best_cycles $best_insts"
+}
+
+# Ratio of 9cc to another compiler, on cycles if known, else time.
+ratio() {
+    awk "BEGIN { printf \"%.2f\", $1 / $2 }"
+}
+
+printf '{"commit":"%s","date":"%s","perf":%s,"kernels":[' \
+    "$(git rev-parse --short HEAD 2>/dev/null || echo unknown)" \
+    "$(date -u +%Y-%m-%dT%H:%M:%SZ)" "${have_perf:+true}${have_perf:-false}" > "$OUT"
+printf '%-10s %-8s %10s %14s %14s %8s\n' kernel compiler ms cycles instructions "9cc/x"
+
+sep=
+for src in bench/kernels/*.c; do
+    name=$(basename "$src" .c)
+
+    "$CC9" -c -o "$dir/$name.o" "$src"
+    "$CC" -static -o "$dir/$name.9cc" "$dir/$name.o"
+    set +e
+    "$dir/$name.9cc"
+    expect=$?
+    set -e
+
+    printf '%s{"name":"%s","exit":%d,"results":[' "$sep" "$name" "$expect" >> "$OUT"
+    set -- $(measure "$dir/$name.9cc")
+    base_ms=$1
+    base_cycles=$2
+    printf '{"compiler":"9cc","ms":%s,"cycles":%s,"instructions":%s}' "$1" "$2" "$3" >> "$OUT"
+    printf '%-10s %-8s %10s %14s %14s %8s\n' "$name" 9cc "$1" "$2" "$3" 1.00
+
+    for level in $LEVELS; do
+        bin=$dir/$name.O$level
+        "$CC" -O"$level" -w -static -o "$bin" "$src"
+        set +e
+        "$bin"
+        status=$?
+        set -e
+        set -- $(measure "$bin")
+        if [ "$base_cycles" != null ]; then
+            r=$(ratio "$base_cycles" "$2")
+        else
+            r=$(ratio "$base_ms" "$1")
+        fi
+        ok=true
+        if [ "$status" -ne "$expect" ]; then
+            ok=false
+            echo "$name: gcc -O$level exited with $status, 9cc build with $expect" >&2
+        fi
+        printf ',{"compiler":"gcc -O%s","ms":%s,"cycles":%s,"instructions":%s,"ratio":%s,"same_exit":%s}' \
+            "$level" "$1" "$2" "$3" "$r" "$ok" >> "$OUT"
+        printf '%-10s %-8s %10s %14s %14s %8s\n' "$name" "gcc -O$level" "$1" "$2" "$3" "$r"
+    done
+    echo ']}' >> "$OUT"
+    sep=,
+done
+
+echo ']}' >> "$OUT"
+echo "results written to $OUT"
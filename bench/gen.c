@@ -0,0 +1,127 @@
+// Generates synthetic C inputs for the compile-throughput benchmark.
+// Every workload stays within the subset 9cc accepts.
+//
+//   gen <workload> <scale>
+//
+// Workloads:
+//   globals    <scale> global variables of assorted types
+//   nesting    expressions nested <scale> levels deep
+//   functions  <scale> small functions calling each other
+//   strings    <scale> string literals of 1000 bytes each, just under
+//              the tokenizer's limit
+//   structs    <scale> functions built on local typedefs and structs
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void gen_globals(int n) {
+    for (int i = 0; i < n; i++) {
+        switch (i % 5) {
+        case 0: printf("int g%d;\n", i); break;
+        case 1: printf("long g%d[%d];\n", i, i % 64 + 1); break;
+        case 2: printf("char *g%d;\n", i); break;
+        case 3: printf("struct { int a; long b; char c[%d]; } g%d;\n", i % 16 + 1, i); break;
+        case 4: printf("short g%d[4][%d];\n", i, i % 8 + 1); break;
+        }
+    }
+    printf("int main() {\n");
+    for (int i = 0; i < n; i += 5) {
+        printf("  g%d = %d;\n", i, i);
+    }
+    printf("  return 0;\n}\n");
+}
+
+static void gen_nesting(int depth) {
+    // Right-nested sums exhaust the register stack and spill; left-nested
+    // ones stress the parser's recursion instead.
+    printf("int f(int x) {\n  return ");
+    for (int i = 0; i < depth; i++) {
+        printf("(x + ");
+    }
+    printf("1");
+    for (int i = 0; i < depth; i++) {
+        printf(")");
+    }
+    printf(";\n}\n\nint g(int x) {\n  return ");
+    for (int i = 0; i < depth; i++) {
+        printf("(");
+    }
+    printf("x");
+    for (int i = 0; i < depth; i++) {
+        printf(" * %d - x)", i % 3 + 1);
+    }
+    printf(" < %d", depth);
+    printf(";\n}\n\nint main() {\n  return f(1) + g(2);\n}\n");
+}
+
+static void gen_functions(int n) {
+    printf("int counter;\n\n");
+    for (int i = 0; i < n; i++) {
+        printf("int f%d(int a, int b, long c) {\n", i);
+        printf("  int x;\n  int y;\n  x = a * %d + b;\n", i % 13 + 1);
+        printf("  y = 0;\n  while (x > %d) {\n    x = x - c;\n    y = y + 1;\n  }\n", i % 100);
+        printf("  if (y < 10) {\n    counter = counter + 1;\n  } else {\n    y = y / 2;\n  }\n");
+        if (i > 0) {
+            printf("  return y + f%d(b, a, c + 1);\n}\n\n", i - 1);
+        } else {
+            printf("  return y;\n}\n\n");
+        }
+    }
+    printf("int main() {\n  return f%d(1, 2, 3);\n}\n", n - 1);
+}
+
+static void gen_strings(int n) {
+    for (int i = 0; i < n; i++) {
+        printf("char *s%d() {\n  return \"", i);
+        for (int j = 0; j < 1000; j++) {
+            int c = 'a' + (i + j) % 26;
+            if (j % 97 == 0) {
+                printf("\\n");
+            } else {
+                putchar(c);
+            }
+        }
+        printf("\";\n}\n\n");
+    }
+    printf("int main() {\n  return s0()[1];\n}\n");
+}
+
+static void gen_structs(int n) {
+    for (int i = 0; i < n; i++) {
+        printf("int f%d(int n) {\n", i);
+        printf("  typedef struct { int x; long y; char tag[8]; } Point%d;\n", i);
+        printf("  typedef struct { Point%d p[4]; Point%d *cur; int count; } Path%d;\n", i, i, i);
+        printf("  Path%d path;\n  Point%d *q;\n  int i;\n", i, i);
+        printf("  path.count = 0;\n");
+        printf("  for (i = 0; i < 4; i = i + 1) {\n");
+        printf("    q = &path.p[i];\n    q->x = i * n;\n    q->y = q->x + %d;\n", i);
+        printf("    q->tag[0] = 65 + i;\n    path.cur = q;\n    path.count = path.count + 1;\n");
+        printf("  }\n  return path.cur->x + path.p[2].y + sizeof(Path%d);\n}\n\n", i);
+    }
+    printf("int main() {\n  return f0(1);\n}\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <workload> <scale>\n", argv[0]);
+        return 1;
+    }
+    char *kind = argv[1];
+    int scale = atoi(argv[2]);
+
+    if (!strcmp(kind, "globals")) {
+        gen_globals(scale);
+    } else if (!strcmp(kind, "nesting")) {
+        gen_nesting(scale);
+    } else if (!strcmp(kind, "functions")) {
+        gen_functions(scale);
+    } else if (!strcmp(kind, "strings")) {
+        gen_strings(scale);
+    } else if (!strcmp(kind, "structs")) {
+        gen_structs(scale);
+    } else {
+        fprintf(stderr, "unknown workload: %s\n", kind);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,21 @@
+// Nested loops over a global array: prefix sums and a reduction.
+int a[4096];
+
+int main() {
+  int i;
+  int round;
+  long sum;
+  sum = 0;
+  for (i = 0; i < 4096; i = i + 1) {
+    a[i] = i * 7 - i / 3;
+  }
+  for (round = 0; round < 3000; round = round + 1) {
+    for (i = 1; i < 4096; i = i + 1) {
+      a[i] = a[i] - a[i - 1] / 2 + round;
+    }
+    for (i = 0; i < 4096; i = i + 1) {
+      sum = sum + a[i];
+    }
+  }
+  return sum - sum / 256 * 256;
+}
@@ -0,0 +1,37 @@
+// Pointer chasing through a linked list whose order is scrambled
+// across the array, so every step is a dependent load.
+// The link is a void pointer because 9cc cannot refer to a struct
+// inside its own definition.
+struct node {
+  void *next;
+  long val;
+} nodes[65536];
+
+int main() {
+  long i;
+  long j;
+  int round;
+  long sum;
+  struct node *n;
+  // 40503 is odd, so i * 40503 modulo 65536 visits every slot once.
+  for (i = 0; i < 65536; i = i + 1) {
+    j = i * 40503 - i * 40503 / 65536 * 65536;
+    nodes[j].val = i;
+    if (i == 65535) {
+      nodes[j].next = &nodes[0];
+    } else {
+      j = (i + 1) * 40503 - (i + 1) * 40503 / 65536 * 65536;
+      nodes[i * 40503 - i * 40503 / 65536 * 65536].next = &nodes[j];
+    }
+  }
+  sum = 0;
+  n = &nodes[0];
+  for (round = 0; round < 500; round = round + 1) {
+    for (i = 0; i < 65536; i = i + 1) {
+      sum = sum + n->val;
+      n = n->next;
+    }
+  }
+  sum = sum / 1000;
+  return sum - sum / 256 * 256;
+}
@@ -0,0 +1,23 @@
+// Call-heavy code: naive Fibonacci and Ackermann.
+int fib(int n) {
+  if (n < 2) {
+    return n;
+  }
+  return fib(n - 1) + fib(n - 2);
+}
+
+int ack(int m, int n) {
+  if (m == 0) {
+    return n + 1;
+  }
+  if (n == 0) {
+    return ack(m - 1, 1);
+  }
+  return ack(m - 1, ack(m, n - 1));
+}
+
+int main() {
+  long sum;
+  sum = fib(32) + ack(2, 2000) + ack(3, 7);
+  return sum - sum / 256 * 256;
+}
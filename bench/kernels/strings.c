@@ -0,0 +1,49 @@
+// Byte-at-a-time string scanning: length, character counts and a
+// naive substring search.
+int len(char *s) {
+  int n;
+  n = 0;
+  while (s[n]) {
+    n = n + 1;
+  }
+  return n;
+}
+
+int count(char *s, int c) {
+  int n;
+  n = 0;
+  for (; *s; s = s + 1) {
+    if (*s == c) {
+      n = n + 1;
+    }
+  }
+  return n;
+}
+
+int find(char *s, char *pat) {
+  int i;
+  int j;
+  for (i = 0; s[i]; i = i + 1) {
+    // There is no && in 9cc; the product is nonzero only if both are.
+    j = 0;
+    while (pat[j] * (s[i + j] == pat[j])) {
+      j = j + 1;
+    }
+    if (pat[j] == 0) {
+      return i;
+    }
+  }
+  return 0 - 1;
+}
+
+int main() {
+  char *text;
+  int round;
+  long sum;
+  text = "the quick brown fox jumps over the lazy dog while the lazy cat sleeps in the warm sun and the brown dog barks at the mailman who walks by every day at noon to deliver letters and parcels to everyone on the street including the old man with the hat";
+  sum = 0;
+  for (round = 0; round < 100000; round = round + 1) {
+    sum = sum + len(text) + count(text, 101) + find(text, "mailman") + round;
+  }
+  return sum - sum / 256 * 256;
+}
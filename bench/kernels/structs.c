@@ -0,0 +1,41 @@
+// Particle update on an array of structs: field loads, stores and
+// address arithmetic through pointers to members.
+struct {
+  long x;
+  long y;
+  int vx;
+  int vy;
+  char alive;
+} p[1024];
+
+int main() {
+  int i;
+  int step;
+  long sum;
+  for (i = 0; i < 1024; i = i + 1) {
+    p[i].x = i;
+    p[i].y = 1024 - i;
+    p[i].vx = i / 7 - 70;
+    p[i].vy = 3 - i / 100;
+    p[i].alive = 1;
+  }
+  for (step = 0; step < 20000; step = step + 1) {
+    for (i = 0; i < 1024; i = i + 1) {
+      if (p[i].alive) {
+        p[i].x = p[i].x + p[i].vx;
+        p[i].y = p[i].y + p[i].vy;
+        if (p[i].x < 0) {
+          p[i].vx = 0 - p[i].vx;
+        }
+        if (p[i].y < 0) {
+          p[i].vy = 0 - p[i].vy;
+        }
+      }
+    }
+  }
+  sum = 0;
+  for (i = 0; i < 1024; i = i + 1) {
+    sum = sum + p[i].x + p[i].y;
+  }
+  return sum - sum / 256 * 256;
+}
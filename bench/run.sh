@@ -0,0 +1,74 @@
+#!/bin/sh
+# Compile-throughput benchmark. Generates each synthetic workload with
+# bench/gen, compiles it $RUNS times with -ftime-report, keeps the
+# fastest run and writes all results to $OUT as JSON, so that runs on
+# different commits can be compared. A summary goes to stdout.
+set -e
+
+CC9=${CC9:-./9cc}
+GEN=${GEN:-bench/gen}
+OUT=${OUT:-bench.json}
+RUNS=${RUNS:-3}
+WORKLOADS=${WORKLOADS:-"globals:20000 nesting:2000 functions:20000 strings:5000 structs:5000"}
+
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+
+commit=$(git rev-parse --short HEAD 2>/dev/null || echo unknown)
+printf '{"commit":"%s","date":"%s","runs":%d,"workloads":[' \
+    "$commit" "$(date -u +%Y-%m-%dT%H:%M:%SZ)" "$RUNS" > "$OUT"
+printf '%-10s %8s %10s %10s %12s %12s %10s\n' \
+    workload lines tokens ms tokens/s lines/s "RSS KiB"
+
+sep=
+for w in $WORKLOADS; do
+    name=${w%:*}
+    scale=${w#*:}
+    src=$dir/$name.c
+    "$GEN" "$name" "$scale" > "$src"
+    lines=$(wc -l < "$src")
+    bytes=$(wc -c < "$src")
+
+    best=
+    best_ms=
+    i=0
+    while [ $i -lt "$RUNS" ]; do
+        "$CC9" -ftime-report "$src" > /dev/null 2> "$dir/report.$i"
+        ms=$(awk '$1 == "total" { print $2 }' "$dir/report.$i")
+        if [ -z "$best" ] || awk "BEGIN { exit !($ms < $best_ms) }"; then
+            best=$dir/report.$i
+            best_ms=$ms
+        fi
+        i=$((i + 1))
+    done
+
+    # The phase table runs from the header line to "total".
+    awk -v name="$name" -v scale="$scale" -v lines="$lines" -v bytes="$bytes" \
+        -v sep="$sep" -v summary="$dir/summary" '
+        $1 == "phase" { in_table = 1; next }
+        in_table && $1 == "total" {
+            ms = $2
+            tokens = substr($3, 2)
+            in_table = 0
+            next
+        }
+        in_table {
+            phases = phases (phases ? "," : "") sprintf("\"%s\":%s", $1, $2)
+            if ($8 > rss) rss = $8
+        }
+        END {
+            s = ms / 1000
+            printf "%s{\"name\":\"%s\",\"scale\":%d,\"lines\":%d,\"bytes\":%d,\"tokens\":%d,", \
+                sep, name, scale, lines, bytes, tokens
+            printf "\"ms\":%s,\"tokens_per_s\":%.0f,\"lines_per_s\":%.0f,\"peak_rss_kib\":%d,", \
+                ms, tokens / s, lines / s, rss
+            printf "\"phases_ms\":{%s}}", phases
+            printf "%-10s %8d %10d %10.1f %12.0f %12.0f %10d\n", \
+                name, lines, tokens, ms, tokens / s, lines / s, rss > summary
+        }' "$best" >> "$OUT"
+    cat "$dir/summary"
+    sep=,
+done
+
+echo ']}' >> "$OUT"
+echo "results written to $OUT"
@@ -0,0 +1,170 @@
+#include "9cc.h"
+
+// Function-granular compilation cache. The assembly of every function
+// is stored in the cache directory under a 64-bit key computed by the
+// parser from the function's tokens and the declarations they refer
+// to. On a hit the parser skips the function body and the stored text
+// is copied to the output instead.
+//
+// Keys are seeded with a hash of the compiler binary and the options
+// that change code generation, so a rebuilt compiler never picks up
+// stale entries.
+
+static uint64_t seed;
+static int hits;
+static int misses;
+
+uint64_t hash64(uint64_t h, void *data, long len) {
+    unsigned char *p = data;
+    for (long i = 0; i < len; i++) {
+        h = (h ^ p[i]) * 1099511628211u;
+    }
+    return h;
+}
+
+// Types currently being hashed, so that a struct that points to itself
+// is hashed as a back reference instead of forever.
+#define MAX_TYPE_DEPTH 32
+
+static uint64_t do_hash_type(uint64_t h, Type *ty, Type **stack, int depth) {
+    if (!ty) {
+        return hash64(h, "", 1);
+    }
+    for (int i = 0; i < depth; i++) {
+        if (stack[i] == ty) {
+            h = hash64(h, "@", 1);
+            return hash64(h, &i, sizeof(i));
+        }
+    }
+    if (depth == MAX_TYPE_DEPTH) {
+        error("type nested too deeply");
+    }
+    stack[depth++] = ty;
+
+    h = hash64(h, &ty->kind, sizeof(ty->kind));
+    h = hash64(h, &ty->align, sizeof(ty->align));
+    h = hash64(h, &ty->array_size, sizeof(ty->array_size));
+    h = do_hash_type(h, ty->base, stack, depth);
+    h = do_hash_type(h, ty->return_ty, stack, depth);
+    for (Member *mem = ty->members; mem; mem = mem->next) {
+        h = hash64(h, mem->name, strlen(mem->name) + 1);
+        h = hash64(h, &mem->offset, sizeof(mem->offset));
+        h = do_hash_type(h, mem->ty, stack, depth);
+    }
+    return h;
+}
+
+uint64_t hash_type(uint64_t h, Type *ty) {
+    Type *stack[MAX_TYPE_DEPTH];
+    return do_hash_type(h, ty, stack, 0);
+}
+
+// Hashes our own executable, once per process.
+static uint64_t compiler_hash(void) {
+    static uint64_t h;
+    if (h) {
+        return h;
+    }
+
+    h = 14695981039346656037u;
+    int fd = open("/proc/self/exe", O_RDONLY);
+    if (fd < 0) {
+        error("cannot open /proc/self/exe: %s", strerror(errno));
+    }
+    char buf[64 * 1024];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) {
+        h = hash64(h, buf, n);
+    }
+    close(fd);
+    return h;
+}
+
+void cache_init(void) {
+    hits = misses = 0;
+    if (mkdir(opt_cache, 0755) < 0 && errno != EEXIST) {
+        error("cannot create cache directory %s: %s", opt_cache, strerror(errno));
+    }
+    seed = compiler_hash();
+    seed = hash64(seed, &opt_fold, sizeof(opt_fold));
+    seed = hash64(seed, &opt_ssa, sizeof(opt_ssa));
+    seed = hash64(seed, &opt_peephole, sizeof(opt_peephole));
+    seed = hash64(seed, &opt_align_loops, sizeof(opt_align_loops));
+    seed = hash64(seed, &opt_omit_frame_pointer, sizeof(opt_omit_frame_pointer));
+    seed = hash64(seed, &opt_inline_limit, sizeof(opt_inline_limit));
+    seed = hash64(seed, &opt_dce, sizeof(opt_dce));
+}
+
+uint64_t cache_seed(void) {
+    return seed;
+}
+
+static char *entry_path(uint64_t key) {
+    return format("%s/%016lx.s", opt_cache, (unsigned long)key);
+}
+
+// Returns the stored assembly for `key`, or NULL on a miss.
+char *cache_lookup(uint64_t key, long *len) {
+    int fd = open(entry_path(key), O_RDONLY);
+    if (fd < 0) {
+        misses++;
+        return NULL;
+    }
+
+    struct stat st;
+    char *buf = NULL;
+    if (fstat(fd, &st) == 0) {
+        buf = malloc(st.st_size + 1);
+        long off = 0;
+        while (off < st.st_size) {
+            ssize_t n = read(fd, buf + off, st.st_size - off);
+            if (n <= 0) {
+                break;
+            }
+            off += n;
+        }
+        if (off != st.st_size) {
+            free(buf);
+            buf = NULL;
+        }
+    }
+    close(fd);
+
+    if (!buf) {
+        misses++;
+        return NULL;
+    }
+    hits++;
+    *len = st.st_size;
+    return buf;
+}
+
+// Stores the assembly of a function. The entry is written to a
+// temporary file and renamed into place, so concurrent compilers never
+// see a partial entry. Failures only cost a future miss.
+void cache_store(uint64_t key, char *text, long len) {
+    char *path = entry_path(key);
+    char *tmp = format("%s.%d.tmp", path, (int)getpid());
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return;
+    }
+
+    long off = 0;
+    while (off < len) {
+        ssize_t n = write(fd, text + off, len - off);
+        if (n <= 0) {
+            break;
+        }
+        off += n;
+    }
+    close(fd);
+
+    if (off != len || rename(tmp, path) < 0) {
+        unlink(tmp);
+    }
+}
+
+void cache_report(FILE *fp) {
+    fprintf(fp, "cache: %d hits, %d misses\n", hits, misses);
+}
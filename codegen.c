@@ -1,356 +1,822 @@
-#include "9cc.h"
-
-static int label_count = 0;
-char *argreg1[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
-char *argreg2[] = {"di", "si", "dx", "cx", "r8w", "r9w"};
-char *argreg4[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
-char *argreg8[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
-
-char *funcname;
-
-void gen_addr(Node *node) {
-    switch (node->kind)
-    {
-        case ND_VAR: {
-            Var *var = node->var;
-            if (var->is_local) {
-                printf("  lea rax, [rbp-%d]\n", var->offset);
-                printf("  push rax\n");
-            }
-            else {
-                printf("  push offset %s\n", var->name);
-            }
-            return;
-        }
-        case ND_DEREF: {
-            gen(node->lhs);
-            return;
-        }
-        case ND_MEMBER: {
-            gen_addr(node->lhs);
-            printf("  pop rax\n");
-            printf("  add rax, %d\n", node->member->offset);
-            printf("  push rax\n");
-            return;
-        }
-    }
-    error_tok(node->tok, "not an local value\n");
-    // if (node->kind != ND_VAR) {
-    //     error("Substitution of the left value does not a variable. actual: %d", node->kind);
-    // }
-
-}
-
-void gen_lval(Node *node) {
-    if (node->ty->kind == TY_ARRAY) {
-        error_tok(node->tok, "not an local value");
-    }
-    gen_addr(node);
-}
-void load(Type *ty) {
-    printf("  pop rax\n");
-
-    int sz = size_of(ty);
-    if (sz == 1) {
-        printf("  movsx rax, byte ptr [rax]\n");
-    } else if (sz == 2) {
-        printf("  movsx rax, word ptr [rax]\n");
-    } else if (sz == 4) {
-        printf("  movsxd rax, dword ptr [rax]\n");
-    } else {
-        assert(sz == 8);
-        printf("  mov rax, [rax]\n");
-    }
-    printf("  push rax\n");
-}
-void store(Type *ty) {
-    printf("  pop rdi\n");
-    printf("  pop rax\n");
-
-    if (ty->kind == TY_BOOL) {
-        printf("  cmp rdi, 0\n");
-        printf("setne dil\n");
-        printf("  movzb rdi, dil\n");
-    }
-    int sz = size_of(ty);
-    if (sz == 1) {
-        printf("  mov [rax], dil\n");
-    } else if (sz == 2) {
-        printf("  mov [rax], di\n");
-    } else if (sz == 4) {
-        printf("  mov [rax], edi\n");
-    }
-    else {
-        assert(sz == 8);
-        printf("  mov [rax], rdi\n");
-    }
-    printf("  push rdi\n");
-}
-
-void gen(Node *node) {
-    
-    if (!node) return;
-
-
-    switch (node->kind) {
-    case ND_NULL:
-        return;
-    case ND_NUM:
-        if (node->val == (int)node->val) {
-            printf("  push %ld\n", node->val);
-        } else {
-            printf("  movabs rax, %ld\n", node->val);
-            printf("  push rax\n");
-        }
-        return;
-    case ND_EXPR_STMT:
-        gen(node->lhs);
-        printf("  add rsp, 8\n");
-        return;
-    case ND_VAR:
-    case ND_MEMBER:
-        gen_addr(node);
-        if (node->ty->kind != TY_ARRAY) {
-            load(node->ty);
-        }
-        return;
-    case ND_ASSIGN:
-        gen_lval(node->lhs);
-        gen(node->rhs);
-
-        store(node->ty);
-        return;
-    case ND_ADDR: {
-        gen_addr(node->lhs);
-        return;
-    }
-    case ND_DEREF: {
-        gen(node->lhs);
-       if (node->ty->kind != TY_ARRAY) {
-           load(node->ty);
-       }
-        return;
-    }
-    case ND_IF: {
-        int cnt = label_count++;
-        if (node->els) {
-            gen(node->cond);
-            printf("  pop rax\n");
-            printf("  cmp rax, 0\n");
-            printf("  je  .Lelse%d\n", cnt);
-            gen(node->then);
-            printf("  jmp .Lend%d\n", cnt);
-            printf(".Lelse%d:\n", cnt);
-            gen(node->els);
-            printf(".Lend%d:\n", cnt);
-        } else {
-            gen(node->cond);
-            printf("  pop rax\n");
-            printf("  cmp rax, 0\n");
-            printf("  je  .Lend%d\n", cnt);
-            gen(node->then);
-            printf(".Lend%d:\n", cnt);
-        }
-        return;
-    }
-    case ND_WHILE: {
-        int cnt = label_count++;
-        printf(".Lbegin%d:\n", cnt);
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .Lend%d\n", cnt);
-        gen(node->then);
-        printf("  jmp .Lbegin%d\n", cnt);
-        printf(".Lend%d:\n", cnt);
-        return;
-    }
-    case ND_FOR: {
-        int cnt = label_count++;
-        if (node->init) {
-            gen(node->init);
-        }
-        printf(".Lbegin%d:\n", cnt);
-        if (node->cond) {
-            gen(node->cond);
-            printf("  pop rax\n");
-            printf("  cmp rax, 0\n");
-            printf("  je  .Lend%d\n", cnt);
-        }
-        gen(node->then);
-        if (node->inc) {
-            gen(node->inc);
-        }
-        printf("  jmp .Lbegin%d\n", cnt);
-        printf(".Lend%d:\n", cnt);
-        return;
-    }
-    case ND_BLOCK:
-        for (Node *n = node->body; n; n = n->next) {
-            gen(n);
-        }
-        return;
-    case ND_STMT_EXPR:
-        for (Node *n = node->body; n; n = n->next) {
-            gen(n);
-        }
-        return;
-    case ND_FUNCALL: {
-        int nargs = 0;
-        for (Node *arg = node->args; arg; arg = arg->next) {
-            gen(arg);
-            nargs++;
-        }
-        for (int i = nargs - 1; i >= 0; i--) {
-            printf("  pop %s\n", argreg8[i]);
-        }
-
-        // We need to align RSP to a 16 byte boundary before
-        // calling a function because it is an ABI requirement.
-        // RAX is set to 0 for variadic function.
-        int cnt = label_count++;
-        printf("  mov rax, rsp\n");
-        printf("  and rax, 15\n");
-        printf("  jnz .Lcall%d\n", cnt);
-        printf("  mov rax, 0\n");
-        printf("  call %s\n", node->funcname);
-        printf("  jmp .Lend%d\n", cnt);
-        printf(".Lcall%d:\n", cnt);
-        printf("  sub rsp, 8\n");
-        printf("  mov rax, 0\n");
-        printf("  call %s\n", node->funcname);
-        printf("  add rsp, 8\n");
-        printf(".Lend%d:\n",cnt);
-        printf("  push rax\n");
-        return;
-    }
-    case ND_RETURN:
-        gen(node->lhs);
-        printf("  pop rax\n");
-        printf("  jmp .Lreturn.%s\n", funcname);
-        return;
-    }
-
-    gen(node->lhs);
-    gen(node->rhs);
-
-    printf("  pop rdi\n");
-    printf("  pop rax\n");
-
-    switch (node->kind) {
-        case ND_ADD:
-            if (node->ty->base) {
-                
-                printf("  imul rdi, %d\n", size_of(node->ty->base));
-            }
-            printf("  add rax, rdi\n");
-            break;
-        case ND_SUB:
-        if (node->ty->base) {
-                printf("  imul rdi, %d\n", size_of(node->ty->base));
-            }
-            printf("  sub rax, rdi\n");
-            break;
-        case ND_MUL:
-            printf("  imul rax, rdi\n");
-            break;
-        case ND_DIV:
-            printf("  cqo\n");
-            printf("  idiv rdi\n");
-            break;
-        case ND_EQ:
-            printf("  cmp rax, rdi\n");
-            printf("  sete al\n");
-            printf("  movzb rax, al\n");
-            break;
-        case ND_NE:
-            printf("  cmp rax, rdi\n");
-            printf("  setne al\n");
-            printf("  movzb rax, al\n");
-            break;
-        case ND_LT:
-            printf("  cmp rax, rdi\n");
-            printf("  setl al\n");
-            printf("  movzb rax, al\n");
-            break;
-
-        case ND_LE:
-            printf("  cmp rax, rdi\n");
-            printf("  setle al\n");
-            printf("  movzb rax, al\n");
-            break;
-
-    }
-    printf("  push rax\n");
-}
-
-void emit_data(Program *prog) {
-    printf(".data\n");
-
-    for (VarList *vl = prog->globals; vl; vl = vl->next) {
-        Var *var = vl->var;
-        printf("%s:\n", var->name);
-        if (!var->contents) {
-            printf("  .zero %d\n", size_of(var->ty));
-        }
-        
-        for (int i = 0; i < var->cont_len; i++) {
-            printf("  .byte %d\n", var->contents[i]);
-        }
-        
-    }
-}
-
-void load_arg(Var *var, int idx) {
-    int sz = size_of(var->ty);
-    if (sz == 1) {
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
-    } else if (sz == 2) {
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg2[idx]);
-    } else if (sz == 4) {
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg4[idx]);
-    }
-    else {
-        assert(sz == 8);
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
-    }
-}
-
-void emit_text(Program *prog) {
-    printf(".text\n");
-    for (Function *fn = prog->fns; fn; fn = fn->next) {
-        printf(".global %s\n", fn->name);
-        printf("%s:\n", fn->name);
-        funcname = fn->name;
-
-        // prologue
-        printf("  push rbp\n");
-        printf("  mov rbp, rsp\n");
-        printf("  sub rsp, %d\n", fn->stack_size);
-
-        int i = 0;
-        for (VarList *vl = fn->params; vl; vl = vl->next) {
-            load_arg(vl->var, i++);
-        }
-
-        //emit code
-        for (Node *node = fn->node; node; node = node->next) {
-            gen(node);
-        }
-
-        // epilogue
-        printf(".Lreturn.%s:\n", funcname);
-        printf("  mov rsp, rbp\n");
-        printf("  pop rbp\n");
-        printf("  ret\n");
-
-    }
-
-}
-
-void codegen(Program *prog) {
-    printf(".intel_syntax noprefix\n");
-
-    emit_data(prog);
-    emit_text(prog);
-}
\ No newline at end of file
+#include "9cc.h"
+
+static Reg argreg[] = {REG_RDI, REG_RSI, REG_RDX, REG_RCX, REG_R8, REG_R9};
+
+// Registers for temporaries. Expression values live on a stack of
+// registers instead of on the machine stack; `top` is its depth and
+// reg(top-1) holds the most recent value. The order is chosen so that
+// argument i of a call is evaluated at depth i straight into its
+// argument register (or into r10/r11 for rdx/rcx, which are clobbered
+// by cqo/idiv). The extra last entry, rcx, is a scratch register used
+// only when the stack overflows and an operand has to be spilled.
+#define NUM_REGS 6
+static Reg tmpreg[] = {REG_RDI, REG_RSI, REG_R10, REG_R11, REG_R8, REG_R9, REG_RCX};
+
+static _Thread_local int top;
+
+// Bytes pushed on the machine stack below the frame. The frame size is
+// a multiple of 16, so RSP is aligned for a call when this is too.
+static _Thread_local int depth;
+
+// How a function addresses its locals.
+typedef enum {
+    FR_RBP,         // push rbp; mov rbp, rsp; sub rsp, size
+    FR_RSP,         // sub rsp, size+8, and locals relative to rsp
+    FR_RED_ZONE,    // a leaf's locals below rsp, which does not move
+} FrameKind;
+
+static _Thread_local FrameKind frame;
+static _Thread_local int frame_size;
+static _Thread_local bool spilled;
+
+// Local labels are numbered per function and qualified with its name,
+// so that functions can be generated independently of each other.
+typedef enum {
+    L_ELSE,
+    L_END,
+    L_BEGIN,
+    L_JOIN,     // ND_LABEL, numbered by the inliner
+    NUM_LABELS,
+} LabelKind;
+
+static char *label_kinds[] = {".Lelse.", ".Lend.", ".Lbegin.", ".Ljoin."};
+
+static _Thread_local char *labels[NUM_LABELS];
+static _Thread_local int label_count;
+static _Thread_local char *return_label;
+
+// Returns temporary `idx` as a `size`-byte register operand.
+static Operand reg(int idx, int size) {
+    if (idx < 0 || NUM_REGS < idx) {
+        error("register out of range: %d", idx);
+    }
+    return opd_reg(tmpreg[idx], size);
+}
+
+// Claims the next temporary on the register stack.
+static Operand new_reg(void) {
+    if (top == NUM_REGS) {
+        error("register stack overflow");
+    }
+    return reg(top++, 8);
+}
+
+static Operand rax(void) {
+    return opd_reg(REG_RAX, 8);
+}
+
+static void push(Operand opd) {
+    emit1(I_PUSH, opd);
+    depth += 8;
+    spilled = true;
+}
+
+static void pop(Operand opd) {
+    emit1(I_POP, opd);
+    depth -= 8;
+}
+
+// Returns the frame slot of local `var`.
+static Operand local(Var *var, int size) {
+    switch (frame) {
+    case FR_RSP:
+        return opd_mem(REG_RSP, frame_size - var->offset + depth, size);
+    case FR_RED_ZONE:
+        return opd_mem(REG_RSP, -var->offset, size);
+    }
+    return opd_mem(REG_RBP, -var->offset, size);
+}
+
+void gen_addr(Node *node) {
+    switch (node->kind)
+    {
+        case ND_VAR: {
+            Var *var = node->var;
+            if (var->is_local) {
+                emit2(I_LEA, new_reg(), local(var, 0));
+            }
+            else {
+                emit2(I_LEA, new_reg(), opd_sym(var->name, 0));
+            }
+            return;
+        }
+        case ND_DEREF: {
+            gen(node->lhs);
+            return;
+        }
+        case ND_MEMBER: {
+            gen_addr(node->lhs);
+            emit2(I_ADD, reg(top - 1, 8), opd_imm(node->member->offset));
+            return;
+        }
+    }
+    error_tok(node->tok, "not an local value\n");
+    // if (node->kind != ND_VAR) {
+    //     error("Substitution of the left value does not a variable. actual: %d", node->kind);
+    // }
+
+}
+
+void gen_lval(Node *node) {
+    if (node->ty->kind == TY_ARRAY) {
+        error_tok(node->tok, "not an local value");
+    }
+    gen_addr(node);
+}
+
+// Replaces the address in reg(top-1) with the value it points to.
+void load(Type *ty) {
+    Operand rd = reg(top - 1, 8);
+    Operand addr = opd_mem(rd.reg, 0, 0);
+
+    int sz = size_of(ty);
+    addr.size = sz;
+    if (sz == 1 || sz == 2) {
+        emit2(I_MOVSX, rd, addr);
+    } else if (sz == 4) {
+        emit2(I_MOVSXD, rd, addr);
+    } else {
+        assert(sz == 8);
+        emit2(I_MOV, rd, addr);
+    }
+}
+
+// Stores the value in temporary `rs` to the address in reg(top-1),
+// which is then replaced with the stored value.
+void store(Type *ty, int rs) {
+    Operand rd = reg(top - 1, 8);
+
+    if (ty->kind == TY_BOOL) {
+        emit2(I_CMP, reg(rs, 8), opd_imm(0));
+        emit_cc(I_SETCC, CC_NE, reg(rs, 1));
+        emit2(I_MOVZX, reg(rs, 8), reg(rs, 1));
+    }
+    int sz = size_of(ty);
+    assert(sz == 1 || sz == 2 || sz == 4 || sz == 8);
+    emit2(I_MOV, opd_mem(rd.reg, 0, sz), reg(rs, sz));
+    emit2(I_MOV, rd, reg(rs, 8));
+}
+
+// Generates a binary operation with a constant operand as an immediate
+// operand or a cheaper sequence, or returns false if there is none.
+static bool gen_imm(Node *node) {
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+    if (node->kind == ND_MUL && lhs->kind == ND_NUM) {
+        lhs = node->rhs;
+        rhs = node->lhs;
+    }
+    // -x is parsed as 0 - x.
+    if (node->kind == ND_SUB && lhs->kind == ND_NUM && lhs->val == 0) {
+        gen(rhs);
+        emit1(I_NEG, reg(top - 1, 8));
+        return true;
+    }
+    if (rhs->kind != ND_NUM) {
+        return false;
+    }
+
+    unsigned long val = rhs->val;
+    switch (node->kind) {
+    case ND_ADD:
+    case ND_SUB:
+        if (node->ty->base) {
+            val *= size_of(node->ty->base);
+        }
+        if ((long)val != (int)val) {
+            return false;
+        }
+        gen(lhs);
+        emit2(node->kind == ND_ADD ? I_ADD : I_SUB, reg(top - 1, 8), opd_imm(val));
+        return true;
+    case ND_MUL:
+        gen(lhs);
+        mul_imm(tmpreg[top - 1], val);
+        return true;
+    case ND_DIV:
+        if (val == 0) {
+            return false;
+        }
+        gen(lhs);
+        div_imm(tmpreg[top - 1], val);
+        return true;
+    }
+    return false;
+}
+
+// Evaluates the right operand of a binary operation whose left operand
+// is already in reg(top-1) and returns the index of the register that
+// holds it. If the register stack is full, the left operand is spilled
+// to the machine stack while the right one is computed.
+static int gen_rhs(Node *rhs) {
+    if (top < NUM_REGS) {
+        gen(rhs);
+        return --top;
+    }
+
+    push(reg(top - 1, 8));
+    top--;
+    gen(rhs);
+    emit2(I_MOV, reg(NUM_REGS, 8), reg(top - 1, 8));
+    pop(reg(top - 1, 8));
+    return NUM_REGS;
+}
+
+static bool is_compare(Node *node) {
+    switch (node->kind) {
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        return true;
+    }
+    return false;
+}
+
+// Compares the operands of a comparison node, leaving the register
+// stack as it was, and returns the condition under which it holds.
+static Cond gen_compare(Node *node) {
+    static Cond cond_of[] = {[ND_EQ] = CC_E, [ND_NE] = CC_NE, [ND_LT] = CC_L, [ND_LE] = CC_LE};
+    static Cond swapped[] = {[CC_E] = CC_E, [CC_NE] = CC_NE, [CC_L] = CC_G, [CC_LE] = CC_GE};
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+    Cond cc = cond_of[node->kind];
+
+    // a > b is parsed as b < a, so a constant often ends up on the left.
+    if (lhs->kind == ND_NUM && rhs->kind != ND_NUM) {
+        lhs = node->rhs;
+        rhs = node->lhs;
+        cc = swapped[cc];
+    }
+    gen(lhs);
+    if (rhs->kind == ND_NUM && rhs->val == (int)rhs->val) {
+        emit2(I_CMP, reg(--top, 8), opd_imm(rhs->val));
+        return cc;
+    }
+    int rs = gen_rhs(rhs);
+    emit2(I_CMP, reg(--top, 8), reg(rs, 8));
+    return cc;
+}
+
+// Jumps to `label` if the truth of `node` is `sense`, and falls through
+// otherwise. Comparisons branch on the flags directly, and comparing a
+// condition against 0 just flips the sense.
+static void gen_cond(Node *node, bool sense, char *label, int cnt) {
+    if (node->kind == ND_NUM) {
+        if (!!node->val == sense) {
+            emit1(I_JMP, opd_label(label, cnt));
+        }
+        return;
+    }
+    if (node->kind == ND_EQ || node->kind == ND_NE) {
+        Node *zero = node->lhs;
+        Node *other = node->rhs;
+        if (!(zero->kind == ND_NUM && zero->val == 0)) {
+            zero = node->rhs;
+            other = node->lhs;
+        }
+        if (zero->kind == ND_NUM && zero->val == 0) {
+            gen_cond(other, node->kind == ND_NE ? sense : !sense, label, cnt);
+            return;
+        }
+    }
+    if (is_compare(node)) {
+        Cond cc = gen_compare(node);
+        emit_cc(I_JCC, sense ? cc : cc ^ 1, opd_label(label, cnt));
+        return;
+    }
+    gen(node);
+    emit2(I_CMP, reg(--top, 8), opd_imm(0));
+    emit_cc(I_JCC, sense ? CC_NE : CC_E, opd_label(label, cnt));
+}
+
+void gen(Node *node) {
+    
+    if (!node) return;
+
+
+    switch (node->kind) {
+    case ND_NULL:
+        return;
+    case ND_NUM:
+        emit2(I_MOV, new_reg(), opd_imm(node->val));
+        return;
+    case ND_EXPR_STMT:
+        gen(node->lhs);
+        top--;
+        return;
+    case ND_VAR:
+    case ND_MEMBER:
+        gen_addr(node);
+        if (node->ty->kind != TY_ARRAY) {
+            load(node->ty);
+        }
+        return;
+    case ND_ASSIGN: {
+        gen_lval(node->lhs);
+        int rs = gen_rhs(node->rhs);
+        store(node->ty, rs);
+        return;
+    }
+    case ND_ADDR: {
+        gen_addr(node->lhs);
+        return;
+    }
+    case ND_DEREF: {
+        gen(node->lhs);
+       if (node->ty->kind != TY_ARRAY) {
+           load(node->ty);
+       }
+        return;
+    }
+    case ND_IF: {
+        int cnt = label_count++;
+        if (node->els) {
+            gen_cond(node->cond, false, labels[L_ELSE], cnt);
+            gen(node->then);
+            emit1(I_JMP, opd_label(labels[L_END], cnt));
+            emit_label(labels[L_ELSE], cnt);
+            gen(node->els);
+            emit_label(labels[L_END], cnt);
+        } else {
+            gen_cond(node->cond, false, labels[L_END], cnt);
+            gen(node->then);
+            emit_label(labels[L_END], cnt);
+        }
+        return;
+    }
+    case ND_WHILE:
+    case ND_FOR: {
+        // Loops are rotated: the condition is tested once on entry and
+        // then at the bottom, so an iteration takes a single branch.
+        int cnt = label_count++;
+        if (node->init) {
+            gen(node->init);
+        }
+        if (node->cond) {
+            gen_cond(node->cond, false, labels[L_END], cnt);
+        }
+        if (opt_align_loops > 1) {
+            emit1(I_ALIGN, opd_imm(opt_align_loops));
+        }
+        emit_label(labels[L_BEGIN], cnt);
+        gen(node->then);
+        if (node->inc) {
+            gen(node->inc);
+        }
+        if (node->cond) {
+            gen_cond(node->cond, true, labels[L_BEGIN], cnt);
+        } else {
+            emit1(I_JMP, opd_label(labels[L_BEGIN], cnt));
+        }
+        emit_label(labels[L_END], cnt);
+        return;
+    }
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next) {
+            gen(n);
+        }
+        return;
+    case ND_GOTO:
+        emit1(I_JMP, opd_label(labels[L_JOIN], node->val));
+        return;
+    case ND_LABEL:
+        emit_label(labels[L_JOIN], node->val);
+        return;
+    case ND_STMT_EXPR:
+        for (Node *n = node->body; n; n = n->next) {
+            gen(n);
+        }
+        return;
+    case ND_FUNCALL: {
+        // Temporaries are caller-saved, so the live ones are spilled
+        // across the call and the arguments start a fresh register stack.
+        int saved = top;
+        for (int i = 0; i < saved; i++) {
+            push(reg(i, 8));
+        }
+        top = 0;
+
+        int nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next) {
+            if (nargs == 6) {
+                error_tok(arg->tok, "too many arguments");
+            }
+            gen(arg);
+            nargs++;
+        }
+        for (int i = nargs - 1; i >= 0; i--) {
+            if (argreg[i] != tmpreg[i]) {
+                emit2(I_MOV, opd_reg(argreg[i], 8), reg(i, 8));
+            }
+        }
+        top = 0;
+
+        // The ABI wants RSP aligned to 16 bytes at the call, and AL set
+        // to the number of vector registers if the callee is variadic.
+        bool pad = depth % 16;
+        if (pad) {
+            emit2(I_SUB, opd_reg(REG_RSP, 8), opd_imm(8));
+        }
+        if (!node->has_prototype) {
+            emit2(I_XOR, opd_reg(REG_RAX, 4), opd_reg(REG_RAX, 4));
+        }
+        emit1(I_CALL, opd_label(node->funcname, -1));
+        if (pad) {
+            emit2(I_ADD, opd_reg(REG_RSP, 8), opd_imm(8));
+        }
+
+        for (int i = saved - 1; i >= 0; i--) {
+            pop(reg(i, 8));
+        }
+        top = saved;
+        emit2(I_MOV, new_reg(), rax());
+        return;
+    }
+    case ND_RETURN:
+        gen(node->lhs);
+        emit2(I_MOV, rax(), reg(--top, 8));
+        // A return from a statement expression may leave spills behind,
+        // which only the rbp frame's epilogue drops by itself.
+        if (frame == FR_RSP && depth) {
+            emit2(I_ADD, opd_reg(REG_RSP, 8), opd_imm(depth));
+        }
+        emit1(I_JMP, opd_label(return_label, -1));
+        return;
+    }
+
+    if (is_compare(node)) {
+        emit_cc(I_SETCC, gen_compare(node), opd_reg(REG_RAX, 1));
+        emit2(I_MOVZX, new_reg(), opd_reg(REG_RAX, 1));
+        return;
+    }
+    if (gen_imm(node)) {
+        return;
+    }
+
+    gen(node->lhs);
+    int rs = gen_rhs(node->rhs);
+    Operand rd = reg(top - 1, 8);
+    Operand src = reg(rs, 8);
+
+    switch (node->kind) {
+        case ND_ADD:
+            if (node->ty->base) {
+                // Element sizes that are a valid index scale fold into lea.
+                int size = size_of(node->ty->base);
+                if (size == 2 || size == 4 || size == 8) {
+                    emit2(I_LEA, rd, opd_index(rd.reg, src.reg, size, 0));
+                    break;
+                }
+                mul_imm(src.reg, size);
+            }
+            emit2(I_ADD, rd, src);
+            break;
+        case ND_SUB:
+            if (node->ty->base) {
+                mul_imm(src.reg, size_of(node->ty->base));
+            }
+            emit2(I_SUB, rd, src);
+            break;
+        case ND_MUL:
+            emit2(I_IMUL, rd, src);
+            break;
+        case ND_DIV:
+            emit2(I_MOV, rax(), rd);
+            emit0(I_CQO);
+            emit1(I_IDIV, src);
+            emit2(I_MOV, rd, rax());
+            break;
+    }
+}
+
+static void emit_vars(VarList *vars) {
+    for (VarList *vl = vars; vl; vl = vl->next) {
+        Var *var = vl->var;
+        emit_label(var->name, -1);
+        if (!var->contents) {
+            emit1(I_ZERO, opd_imm(size_of(var->ty)));
+        }
+        
+        for (int i = 0; i < var->cont_len; i++) {
+            emit1(I_BYTE, opd_imm(var->contents[i]));
+        }
+        
+    }
+}
+
+void emit_data(Program *prog) {
+    emit0(I_DATA);
+    emit_vars(prog->globals);
+}
+
+void load_arg(Var *var, int idx) {
+    int sz = size_of(var->ty);
+    assert(sz == 1 || sz == 2 || sz == 4 || sz == 8);
+    emit2(I_MOV, local(var, sz), opd_reg(argreg[idx], sz));
+}
+
+// Assigns stack offsets to local variables.
+static void layout_frame(Function *fn) {
+    int offset = 0;
+    for (VarList *vl = fn->locals; vl; vl = vl->next) {
+        Var *var = vl->var;
+        offset = align_to(offset, var->ty->align);
+        offset += size_of(var->ty);
+        var->offset = offset;
+    }
+    fn->stack_size = align_to(offset, 16);
+}
+
+static bool has_call(Node *node) {
+    if (!node) {
+        return false;
+    }
+    if (node->kind == ND_FUNCALL) {
+        return true;
+    }
+    if (has_call(node->lhs) || has_call(node->rhs) || has_call(node->cond) ||
+        has_call(node->then) || has_call(node->els) || has_call(node->init) ||
+        has_call(node->inc)) {
+        return true;
+    }
+    for (Node *n = node->body; n; n = n->next) {
+        if (has_call(n)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Picks the frame for `fn` when its body is not known to spill. A leaf
+// whose locals fit in the 128-byte red zone needs no frame at all, and
+// a function without locals has nothing to address through rbp.
+static FrameKind frame_kind(Function *fn) {
+    bool leaf = true;
+    for (Node *node = fn->node; node; node = node->next) {
+        leaf = leaf && !has_call(node);
+    }
+    if (fn->stack_size <= 128 && leaf) {
+        return FR_RED_ZONE;
+    }
+    if (opt_omit_frame_pointer || fn->stack_size == 0) {
+        return FR_RSP;
+    }
+    return FR_RBP;
+}
+
+// Generates a function with the stack machine, from the prologue to
+// the epilogue.
+static void gen_body(Function *fn, FrameKind kind) {
+    for (int i = 0; i < NUM_LABELS; i++) {
+        labels[i] = format("%s%s.", label_kinds[i], fn->name);
+    }
+    label_count = 0;
+    return_label = format(".Lreturn.%s", fn->name);
+    frame = kind;
+    frame_size = fn->stack_size;
+    spilled = false;
+
+        // prologue
+    if (frame == FR_RBP) {
+        emit1(I_PUSH, opd_reg(REG_RBP, 8));
+        emit2(I_MOV, opd_reg(REG_RBP, 8), opd_reg(REG_RSP, 8));
+        emit2(I_SUB, opd_reg(REG_RSP, 8), opd_imm(frame_size));
+    } else if (frame == FR_RSP) {
+        // The return address leaves RSP 8 bytes off alignment.
+        emit2(I_SUB, opd_reg(REG_RSP, 8), opd_imm(frame_size + 8));
+    }
+
+    int i = 0;
+    for (VarList *vl = fn->params; vl; vl = vl->next) {
+        load_arg(vl->var, i++);
+    }
+
+    //emit code
+    top = 0;
+    depth = 0;
+    for (Node *node = fn->node; node; node = node->next) {
+        gen(node);
+        assert(top == 0 && depth == 0);
+    }
+
+    // epilogue
+    emit_label(return_label, -1);
+    if (frame == FR_RBP) {
+        emit2(I_MOV, opd_reg(REG_RSP, 8), opd_reg(REG_RBP, 8));
+        emit1(I_POP, opd_reg(REG_RBP, 8));
+    } else if (frame == FR_RSP) {
+        emit2(I_ADD, opd_reg(REG_RSP, 8), opd_imm(frame_size + 8));
+    }
+    emit0(I_RET);
+}
+
+// Runs the whole backend for one function. It touches nothing shared
+// with other functions, so it may run on any thread.
+static void gen_function(Function *fn) {
+    Mark start = mark();
+    Mark m = start;
+    add_type(fn);
+    phase_end(PH_TYPE, &m);
+
+    if (opt_fold) {
+        m = mark();
+        fold(fn);
+        phase_end(PH_FOLD, &m);
+    }
+    if (opt_dce) {
+        m = mark();
+        eliminate_dead_code(fn);
+        phase_end(PH_DCE, &m);
+    }
+
+    // With -fssa the function goes through the IR, whose instruction
+    // selector lays out the frame itself.
+    IrFunc *ir = NULL;
+    if (opt_ssa) {
+        m = mark();
+        ir = lower(fn);
+        verify_ir(ir, "lowering");
+        mem2reg(ir);
+        verify_ir(ir, "mem2reg");
+        if (opt_dump_ir) {
+            flockfile(stderr);
+            dump_ir(ir, stderr);
+            funlockfile(stderr);
+        }
+        phase_end(PH_IR, &m);
+    } else {
+        m = mark();
+        layout_frame(fn);
+        phase_end(PH_LAYOUT, &m);
+    }
+
+    m = mark();
+
+    if (fn->literals) {
+        emit0(I_DATA);
+        emit_vars(fn->literals);
+        emit0(I_TEXT);
+    }
+    emit1(I_GLOBAL, opd_label(fn->name, -1));
+    emit_label(fn->name, -1);
+    // Instructions are held back until the function is complete: a leaf
+    // may have to be generated again, and the peephole optimizer works
+    // on the whole function.
+    InstList body = {0};
+    emit_hold(&body);
+    if (ir) {
+        isel(ir);
+    } else {
+        FrameKind kind = frame_kind(fn);
+        gen_body(fn, kind);
+        if (kind == FR_RED_ZONE && spilled) {
+            // Pushes would overwrite the locals in the red zone.
+            body.len = 0;
+            gen_body(fn, opt_omit_frame_pointer || fn->stack_size == 0 ? FR_RSP : FR_RBP);
+        }
+    }
+    emit_hold(NULL);
+
+    if (opt_peephole) {
+        phase_end(PH_GEN, &m);
+        m = mark();
+        peephole(&body);
+        emit_held(&body);
+        phase_end(PH_PEEPHOLE, &m);
+    } else {
+        emit_held(&body);
+        phase_end(PH_GEN, &m);
+    }
+    function_end(fn, &start);
+}
+
+// Functions shared out to worker threads. Each one is generated into
+// its own buffer, and the buffers are written in source order, so the
+// output does not depend on scheduling.
+typedef struct {
+    Function **fns;
+    EmitBuffer *bufs;
+    int num_fns;
+    int next;
+    bool failed;
+    pthread_mutex_t lock;
+} Jobs;
+
+static void run_jobs(Jobs *jobs) {
+    // An error stops this thread and the others after their current
+    // function; the main thread reports it once everyone is done.
+    jmp_buf *saved = error_jmp;
+    jmp_buf jb;
+    if (setjmp(jb)) {
+        pthread_mutex_lock(&jobs->lock);
+        jobs->failed = true;
+        jobs->next = jobs->num_fns;
+        pthread_mutex_unlock(&jobs->lock);
+        emit_capture(NULL);
+        emit_hold(NULL);
+        error_jmp = saved;
+        return;
+    }
+    error_jmp = &jb;
+
+    for (;;) {
+        pthread_mutex_lock(&jobs->lock);
+        int i = jobs->next++;
+        pthread_mutex_unlock(&jobs->lock);
+        if (i >= jobs->num_fns) {
+            break;
+        }
+        if (jobs->fns[i]->cached) {
+            continue;
+        }
+        emit_capture(&jobs->bufs[i]);
+        gen_function(jobs->fns[i]);
+    }
+    emit_capture(NULL);
+    error_jmp = saved;
+}
+
+static void *worker(void *arg) {
+    run_jobs(arg);
+    arena_thread_exit();
+    return NULL;
+}
+
+void emit_text(Program *prog) {
+    emit0(I_TEXT);
+
+    int num_fns = 0;
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        num_fns++;
+    }
+    if (num_fns == 0 || (!opt_cache && (opt_jobs <= 1 || num_fns <= 1))) {
+        for (Function *fn = prog->fns; fn; fn = fn->next) {
+            gen_function(fn);
+        }
+        return;
+    }
+
+    Jobs jobs = {0};
+    jobs.fns = calloc(num_fns, sizeof(Function *));
+    jobs.bufs = calloc(num_fns, sizeof(EmitBuffer));
+    jobs.num_fns = num_fns;
+    pthread_mutex_init(&jobs.lock, NULL);
+    int i = 0;
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        jobs.fns[i++] = fn;
+    }
+
+    // The main thread works too, so start one thread fewer.
+    int nthreads = (opt_jobs < num_fns ? opt_jobs : num_fns) - 1;
+    pthread_t *threads = calloc(nthreads, sizeof(pthread_t));
+    for (i = 0; i < nthreads; i++) {
+        if (pthread_create(&threads[i], NULL, worker, &jobs)) {
+            error("cannot create thread: %s", strerror(errno));
+        }
+    }
+    run_jobs(&jobs);
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    Mark m = mark();
+    for (i = 0; i < num_fns; i++) {
+        Function *fn = jobs.fns[i];
+        EmitBuffer *buf = &jobs.bufs[i];
+        if (jobs.failed) {
+            free(buf->text);
+            free(buf->insts);
+        } else if (fn->cached) {
+            emit_raw(fn->cached, fn->cached_len);
+        } else {
+            if (opt_cache) {
+                cache_store(fn->cache_key, buf->text, buf->len);
+            }
+            emit_buffer(buf);
+        }
+        free(fn->cached);
+    }
+    phase_end(PH_WRITE, &m);
+    pthread_mutex_destroy(&jobs.lock);
+    free(threads);
+    free(jobs.bufs);
+    free(jobs.fns);
+    if (jobs.failed) {
+        die();
+    }
+}
+
+void codegen(Program *prog) {
+    emit_open();
+
+    Mark m = mark();
+    emit_data(prog);
+    phase_end(PH_GEN, &m);
+
+    emit_text(prog);
+
+    m = mark();
+    emit_close();
+    phase_end(PH_WRITE, &m);
+}
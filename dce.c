@@ -0,0 +1,310 @@
+#include "9cc.h"
+
+// Dead code elimination. Runs on each function after fold and removes
+//
+//  - statements that cannot be reached: those after a return or goto,
+//    up to the next label;
+//  - the untaken branch of an if or loop whose condition is constant;
+//  - stores to locals that are never read, keeping any side effects
+//    of the stored value;
+//  - locals that are no longer referenced, so they take no frame space.
+//
+// Pointer arithmetic may walk from one local to its neighbours in the
+// frame, so once the address of a local is taken, the stores and the
+// locals of the function are all kept.
+//
+// Without break or continue, a loop falls through only by its condition
+// becoming false, so one without a condition ends a reachable region too.
+
+typedef enum {
+    D_UNREACHABLE,
+    D_BRANCH,
+    D_STORE,
+    D_VAR,
+    NUM_DEAD,
+} Dead;
+
+static char *dead_names[] = {
+    [D_UNREACHABLE] = "unreachable",
+    [D_BRANCH] = "branch",
+    [D_STORE] = "store",
+    [D_VAR] = "variable",
+};
+
+static long total_removed[NUM_DEAD];
+static long frame_bytes;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static _Thread_local long removed[NUM_DEAD];
+static _Thread_local bool addr_taken;
+
+// Replaces `node` with `with`, keeping node's place in its list.
+static void replace(Node *node, Node *with) {
+    Node *next = node->next;
+    *node = *with;
+    node->next = next;
+}
+
+static bool prune(Node *node);
+static void prune_expr(Node *node);
+
+// Drops the statements of the list at `link` that cannot be reached and
+// returns whether control can reach its end. The last node of a
+// statement expression is its value and always stays.
+static bool prune_list(Node **link, bool value) {
+    bool live = true;
+    while (*link) {
+        Node *node = *link;
+        if (value && !node->next) {
+            prune_expr(node);
+            break;
+        }
+        if (node->kind == ND_LABEL) {
+            live = true;
+        }
+        if (!live) {
+            if (node->kind != ND_NULL) {
+                removed[D_UNREACHABLE]++;
+            }
+            *link = node->next;
+            continue;
+        }
+        live = prune(node);
+        if (node->kind == ND_NULL) {
+            *link = node->next;
+            continue;
+        }
+        link = &node->next;
+    }
+    return live;
+}
+
+// Prunes the statement expressions inside an expression.
+static void prune_expr(Node *node) {
+    if (!node) {
+        return;
+    }
+    if (node->kind == ND_STMT_EXPR) {
+        prune_list(&node->body, true);
+        return;
+    }
+    prune_expr(node->lhs);
+    prune_expr(node->rhs);
+    for (Node *n = node->args; n; n = n->next) {
+        prune_expr(n);
+    }
+}
+
+// Prunes a statement and returns whether control can reach its end.
+static bool prune(Node *node) {
+    switch (node->kind) {
+    case ND_RETURN:
+        prune_expr(node->lhs);
+        return false;
+    case ND_GOTO:
+        return false;
+    case ND_BLOCK:
+        return prune_list(&node->body, false);
+    case ND_IF: {
+        if (node->cond->kind == ND_NUM) {
+            removed[D_BRANCH]++;
+            Node *taken = node->cond->val ? node->then : node->els;
+            if (!taken) {
+                node->kind = ND_NULL;
+                return true;
+            }
+            replace(node, taken);
+            return prune(node);
+        }
+        prune_expr(node->cond);
+        bool then = prune(node->then);
+        bool els = node->els ? prune(node->els) : true;
+        return then || els;
+    }
+    case ND_WHILE:
+    case ND_FOR:
+        if (node->init) {
+            prune(node->init);
+        }
+        if (node->cond && node->cond->kind == ND_NUM && !node->cond->val) {
+            removed[D_BRANCH]++;
+            if (node->init) {
+                replace(node, node->init);
+            } else {
+                node->kind = ND_NULL;
+            }
+            return true;
+        }
+        prune_expr(node->cond);
+        prune(node->then);
+        if (node->inc) {
+            prune(node->inc);
+        }
+        return node->cond && node->cond->kind != ND_NUM;
+    case ND_EXPR_STMT: {
+        // A statement expression used as a statement has no value.
+        Node *expr = node->lhs;
+        if (expr->kind == ND_STMT_EXPR) {
+            Node *last = expr->body;
+            while (last->next) {
+                last = last->next;
+            }
+            if (last->kind != ND_NUM && !has_side_effects(last)) {
+                last->kind = ND_NUM;
+                last->val = 0;
+                last->lhs = last->rhs = NULL;
+                last->ty = int_type();
+            }
+        }
+        prune_expr(expr);
+        return true;
+    }
+    }
+    return true;
+}
+
+// Whether `node` is "x = e;" for a local x.
+static bool is_local_store(Node *node) {
+    return node->kind == ND_EXPR_STMT && node->lhs->kind == ND_ASSIGN &&
+           node->lhs->lhs->kind == ND_VAR && node->lhs->lhs->var->is_local;
+}
+
+// Counts in each local the nodes that refer to it and how many of them
+// are the target of a store statement.
+static void count_refs(Node *node) {
+    if (!node) {
+        return;
+    }
+    if (node->kind == ND_VAR && node->var->is_local) {
+        node->var->refs++;
+        if (node->var->ty->kind == TY_ARRAY) {
+            addr_taken = true;
+        }
+    }
+    if (node->kind == ND_ADDR) {
+        addr_taken = true;
+    }
+    if (is_local_store(node)) {
+        node->lhs->lhs->var->stores++;
+    }
+    count_refs(node->lhs);
+    count_refs(node->rhs);
+    count_refs(node->cond);
+    count_refs(node->then);
+    count_refs(node->els);
+    count_refs(node->init);
+    count_refs(node->inc);
+    for (Node *n = node->body; n; n = n->next) {
+        count_refs(n);
+    }
+    for (Node *n = node->args; n; n = n->next) {
+        count_refs(n);
+    }
+}
+
+// Rewrites stores to locals that are never read, keeping the stored
+// value only for its side effects. Returns whether it removed any.
+static bool remove_stores(Node *node) {
+    if (!node) {
+        return false;
+    }
+    bool changed = false;
+    if (is_local_store(node)) {
+        Var *var = node->lhs->lhs->var;
+        if (var->refs == var->stores) {
+            removed[D_STORE]++;
+            changed = true;
+            Node *val = node->lhs->rhs;
+            if (has_side_effects(val)) {
+                node->lhs = val;
+            } else {
+                node->kind = ND_NULL;
+                node->lhs = NULL;
+                return true;
+            }
+        }
+    }
+    changed |= remove_stores(node->lhs);
+    changed |= remove_stores(node->rhs);
+    changed |= remove_stores(node->cond);
+    changed |= remove_stores(node->then);
+    changed |= remove_stores(node->els);
+    changed |= remove_stores(node->init);
+    changed |= remove_stores(node->inc);
+    for (Node *n = node->body; n; n = n->next) {
+        changed |= remove_stores(n);
+    }
+    for (Node *n = node->args; n; n = n->next) {
+        changed |= remove_stores(n);
+    }
+    return changed;
+}
+
+static bool is_param(Function *fn, Var *var) {
+    for (VarList *vl = fn->params; vl; vl = vl->next) {
+        if (vl->var == var) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void count_all(Function *fn) {
+    addr_taken = false;
+    for (VarList *vl = fn->locals; vl; vl = vl->next) {
+        vl->var->refs = vl->var->stores = 0;
+    }
+    for (Node *node = fn->node; node; node = node->next) {
+        count_refs(node);
+    }
+}
+
+void eliminate_dead_code(Function *fn) {
+    memset(removed, 0, sizeof(removed));
+    prune_list(&fn->node, false);
+
+    // Removing a store may leave another local unread.
+    count_all(fn);
+    bool changed = !addr_taken;
+    while (changed) {
+        changed = false;
+        for (Node *node = fn->node; node; node = node->next) {
+            changed |= remove_stores(node);
+        }
+        count_all(fn);
+    }
+    prune_list(&fn->node, false);
+    count_all(fn);
+
+    long bytes = 0;
+    for (VarList **link = &fn->locals; *link && !addr_taken;) {
+        Var *var = (*link)->var;
+        if (!var->refs && !is_param(fn, var)) {
+            removed[D_VAR]++;
+            bytes += size_of(var->ty);
+            *link = (*link)->next;
+        } else {
+            link = &(*link)->next;
+        }
+    }
+
+    pthread_mutex_lock(&lock);
+    for (int i = 0; i < NUM_DEAD; i++) {
+        total_removed[i] += removed[i];
+    }
+    frame_bytes += bytes;
+    pthread_mutex_unlock(&lock);
+}
+
+void dce_report(FILE *fp) {
+    fprintf(fp, "%-12s %10s\n", "dead", "removed");
+    for (int i = 0; i < NUM_DEAD; i++) {
+        fprintf(fp, "%-12s %10ld\n", dead_names[i], total_removed[i]);
+    }
+    fprintf(fp, "frame: %ld bytes of locals removed\n", frame_bytes);
+}
+
+void reset_dce(void) {
+    memset(total_removed, 0, sizeof(total_removed));
+    frame_bytes = 0;
+}
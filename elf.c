@@ -0,0 +1,607 @@
+#include "9cc.h"
+#include <elf.h>
+
+// Direct object file output. Instructions from the emitter are encoded
+// into machine code and written as an ELF64 relocatable object with
+// .text and .data sections, so no assembler has to run.
+//
+// Jumps and calls always use 32-bit displacements. References to labels
+// in .text are resolved when the object is written; everything else
+// becomes a relocation.
+
+enum {
+    SEC_UNDEF,
+    SEC_TEXT,
+    SEC_DATA,
+};
+
+typedef struct {
+    char *data;
+    long len;
+    long cap;
+} Section;
+
+typedef struct Symbol Symbol;
+struct Symbol {
+    Symbol *next;       // next symbol in the same bucket
+    char *name;
+    unsigned hash;
+    int sec;            // SEC_UNDEF until defined
+    long offset;
+    bool is_global;
+    int index;          // index in .symtab
+};
+
+// A 32-bit PC-relative field in .text that refers to a symbol.
+typedef struct {
+    long offset;
+    Symbol *sym;
+    long addend;
+    bool is_call;
+} Fixup;
+
+static Section sections[3];
+static int cur_sec = SEC_TEXT;
+static int text_align = 16;
+
+#define SYM_TABLE_SIZE 4096
+static Symbol *sym_table[SYM_TABLE_SIZE];
+static Vector *symbols;
+
+static Fixup *fixups;
+static int num_fixups;
+static int cap_fixups;
+
+static void emit_byte(int b) {
+    Section *sec = &sections[cur_sec];
+    if (sec->len == sec->cap) {
+        sec->cap = sec->cap ? sec->cap * 2 : 64 * 1024;
+        sec->data = realloc(sec->data, sec->cap);
+    }
+    sec->data[sec->len++] = b;
+    counters.bytes++;
+}
+
+static void emit_dword(long val) {
+    for (int i = 0; i < 4; i++) {
+        emit_byte(val >> (i * 8));
+    }
+}
+
+static void emit_qword(long val) {
+    for (int i = 0; i < 8; i++) {
+        emit_byte(val >> (i * 8));
+    }
+}
+
+static bool is_int8(long val) {
+    return val == (signed char)val;
+}
+
+// Returns the symbol for a label operand, creating an undefined one
+// on first use.
+static Symbol *get_symbol(char *name, int num) {
+    char buf[256];
+    int len = strlen(name);
+    if (len > sizeof(buf) - 24) {
+        error("symbol name too long: %s", name);
+    }
+    memcpy(buf, name, len);
+    if (num >= 0) {
+        len += sprintf(buf + len, "%d", num);
+    }
+
+    unsigned h = hash_str(buf, len);
+    Symbol **bucket = &sym_table[h % SYM_TABLE_SIZE];
+    for (Symbol *sym = *bucket; sym; sym = sym->next) {
+        if (sym->hash == h && !strncmp(sym->name, buf, len) && !sym->name[len]) {
+            return sym;
+        }
+    }
+
+    Symbol *sym = calloc(1, sizeof(Symbol));
+    sym->name = strndup(buf, len);
+    sym->hash = h;
+    sym->next = *bucket;
+    *bucket = sym;
+    if (!symbols) {
+        symbols = new_vec();
+    }
+    vec_push(symbols, sym);
+    return sym;
+}
+
+// Emits a 32-bit placeholder to be patched with `sym + addend - P`.
+static void emit_fixup(Symbol *sym, long addend, bool is_call) {
+    if (num_fixups == cap_fixups) {
+        cap_fixups = cap_fixups ? cap_fixups * 2 : 1024;
+        fixups = realloc(fixups, sizeof(Fixup) * cap_fixups);
+    }
+    Fixup *fix = &fixups[num_fixups++];
+    fix->offset = sections[cur_sec].len;
+    fix->sym = sym;
+    fix->addend = addend;
+    fix->is_call = is_call;
+    emit_dword(0);
+}
+
+// spl, bpl, sil and dil can only be encoded with a REX prefix.
+static bool needs_rex(Operand *opd) {
+    return opd->kind == OPD_REG && opd->size == 1 && REG_RSP <= opd->reg && opd->reg <= REG_RDI;
+}
+
+// Emits an instruction of the form "opcode ModRM [SIB] [disp]", with
+// `reg` in the reg field (a register or an opcode extension) and `rm`
+// as the register or memory operand. `size` selects the operand-size
+// prefixes and `imm_bytes` is the length of a trailing immediate,
+// which RIP-relative displacements have to account for.
+static void encode(int size, int opcode, int reg, bool byte_reg, Operand *rm, int imm_bytes) {
+    if (size == 2) {
+        emit_byte(0x66);
+    }
+
+    int rex = 0;
+    if (size == 8) {
+        rex |= 8;
+    }
+    if (reg & 8) {
+        rex |= 4;
+    }
+    if (rm->reg != REG_RIP && (rm->reg & 8)) {
+        rex |= 1;
+    }
+    if (rm->kind == OPD_MEM && rm->scale && (rm->index & 8)) {
+        rex |= 2;
+    }
+    bool force = needs_rex(rm) || (byte_reg && REG_RSP <= reg && reg <= REG_RDI);
+    if (rex || force) {
+        emit_byte(0x40 | rex);
+    }
+
+    if (opcode > 0xff) {
+        emit_byte(opcode >> 8);
+    }
+    emit_byte(opcode);
+
+    if (rm->kind == OPD_REG) {
+        emit_byte(0xc0 | (reg & 7) << 3 | (rm->reg & 7));
+        return;
+    }
+
+    assert(rm->kind == OPD_MEM);
+    if (rm->reg == REG_RIP) {
+        emit_byte(0x05 | (reg & 7) << 3);
+        emit_fixup(get_symbol(rm->name, -1), rm->val - 4 - imm_bytes, false);
+        return;
+    }
+
+    int base = rm->reg & 7;
+    long disp = rm->val;
+    int mod = (disp == 0 && base != 5) ? 0 : is_int8(disp) ? 1 : 2;
+    if (rm->scale) {
+        static int scale_bits[] = {[1] = 0, [2] = 1, [4] = 2, [8] = 3};
+        emit_byte(mod << 6 | (reg & 7) << 3 | 4);
+        emit_byte(scale_bits[rm->scale] << 6 | (rm->index & 7) << 3 | base);
+    } else {
+        emit_byte(mod << 6 | (reg & 7) << 3 | base);
+        if (base == 4) {
+            emit_byte(0x24);
+        }
+    }
+    if (mod == 1) {
+        emit_byte(disp);
+    } else if (mod == 2) {
+        emit_dword(disp);
+    }
+}
+
+// add, or, and, sub, xor and cmp share their encodings and differ only
+// in an opcode extension.
+static void encode_alu(int ext, Inst *inst) {
+    Operand *lhs = &inst->lhs;
+    Operand *rhs = &inst->rhs;
+    int size = lhs->size ? lhs->size : rhs->size;
+
+    if (rhs->kind == OPD_IMM) {
+        if (size == 1) {
+            encode(size, 0x80, ext, false, lhs, 1);
+            emit_byte(rhs->val);
+        } else if (is_int8(rhs->val)) {
+            encode(size, 0x83, ext, false, lhs, 1);
+            emit_byte(rhs->val);
+        } else {
+            encode(size, 0x81, ext, false, lhs, 4);
+            emit_dword(rhs->val);
+        }
+        return;
+    }
+    if (rhs->kind == OPD_REG) {
+        encode(size, ext * 8 + (size == 1 ? 0 : 1), rhs->reg, size == 1, lhs, 0);
+        return;
+    }
+    encode(size, ext * 8 + (size == 1 ? 2 : 3), lhs->reg, size == 1, rhs, 0);
+}
+
+static void encode_mov(Inst *inst) {
+    Operand *lhs = &inst->lhs;
+    Operand *rhs = &inst->rhs;
+
+    if (rhs->kind == OPD_IMM) {
+        if (lhs->kind == OPD_REG && lhs->size == 8 && rhs->val != (int)rhs->val) {
+            // movabs
+            emit_byte(0x48 | (lhs->reg & 8 ? 1 : 0));
+            emit_byte(0xb8 + (lhs->reg & 7));
+            emit_qword(rhs->val);
+        } else if (lhs->size == 1) {
+            encode(1, 0xc6, 0, false, lhs, 1);
+            emit_byte(rhs->val);
+        } else if (lhs->size == 2) {
+            encode(2, 0xc7, 0, false, lhs, 2);
+            emit_byte(rhs->val);
+            emit_byte(rhs->val >> 8);
+        } else {
+            encode(lhs->size, 0xc7, 0, false, lhs, 4);
+            emit_dword(rhs->val);
+        }
+        return;
+    }
+    if (rhs->kind == OPD_REG) {
+        encode(rhs->size, rhs->size == 1 ? 0x88 : 0x89, rhs->reg, rhs->size == 1, lhs, 0);
+        return;
+    }
+    encode(lhs->size, lhs->size == 1 ? 0x8a : 0x8b, lhs->reg, lhs->size == 1, rhs, 0);
+}
+
+static void encode_jump(int opcode, Operand *target, bool is_call) {
+    if (opcode > 0xff) {
+        emit_byte(opcode >> 8);
+    }
+    emit_byte(opcode);
+    emit_fixup(get_symbol(target->name, target->num), -4, is_call);
+}
+
+// Pads code with `n` bytes of the recommended multi-byte nops.
+static void emit_nops(int n) {
+    static char *nops[] = {
+        "",
+        "\x90",
+        "\x66\x90",
+        "\x0f\x1f\x00",
+        "\x0f\x1f\x40\x00",
+        "\x0f\x1f\x44\x00\x00",
+        "\x66\x0f\x1f\x44\x00\x00",
+        "\x0f\x1f\x80\x00\x00\x00\x00",
+        "\x0f\x1f\x84\x00\x00\x00\x00\x00",
+        "\x66\x0f\x1f\x84\x00\x00\x00\x00\x00",
+    };
+    while (n > 0) {
+        int len = n < 9 ? n : 9;
+        for (int i = 0; i < len; i++) {
+            emit_byte(nops[len][i]);
+        }
+        n -= len;
+    }
+}
+
+static void encode_push_pop(int opcode, Reg reg) {
+    if (reg & 8) {
+        emit_byte(0x41);
+    }
+    emit_byte(opcode + (reg & 7));
+}
+
+void encode_inst(Inst *inst) {
+    Operand *lhs = &inst->lhs;
+    Operand *rhs = &inst->rhs;
+
+    switch (inst->op) {
+    case I_MOV:
+        encode_mov(inst);
+        return;
+    case I_MOVSX:
+        encode(8, rhs->size == 1 ? 0x0fbe : 0x0fbf, lhs->reg, false, rhs, 0);
+        return;
+    case I_MOVSXD:
+        encode(8, 0x63, lhs->reg, false, rhs, 0);
+        return;
+    case I_MOVZX:
+        encode(lhs->size, rhs->size == 1 ? 0x0fb6 : 0x0fb7, lhs->reg, false, rhs, 0);
+        return;
+    case I_LEA:
+        encode(8, 0x8d, lhs->reg, false, rhs, 0);
+        return;
+    case I_ADD:
+        encode_alu(0, inst);
+        return;
+    case I_AND:
+        encode_alu(4, inst);
+        return;
+    case I_SUB:
+        encode_alu(5, inst);
+        return;
+    case I_XOR:
+        encode_alu(6, inst);
+        return;
+    case I_CMP:
+        encode_alu(7, inst);
+        return;
+    case I_IMUL:
+        if (rhs->kind == OPD_NONE) {
+            // rdx:rax = rax * lhs
+            encode(8, 0xf7, 5, false, lhs, 0);
+            return;
+        }
+        if (rhs->kind == OPD_IMM) {
+            if (is_int8(rhs->val)) {
+                encode(8, 0x6b, lhs->reg, false, lhs, 1);
+                emit_byte(rhs->val);
+            } else {
+                encode(8, 0x69, lhs->reg, false, lhs, 4);
+                emit_dword(rhs->val);
+            }
+            return;
+        }
+        encode(8, 0x0faf, lhs->reg, false, rhs, 0);
+        return;
+    case I_CQO:
+        emit_byte(0x48);
+        emit_byte(0x99);
+        return;
+    case I_IDIV:
+        encode(8, 0xf7, 7, false, lhs, 0);
+        return;
+    case I_NEG:
+        encode(8, 0xf7, 3, false, lhs, 0);
+        return;
+    case I_SHL:
+    case I_SHR:
+    case I_SAR: {
+        static int ext[] = {[I_SHL] = 4, [I_SHR] = 5, [I_SAR] = 7};
+        if (rhs->val == 1) {
+            encode(8, 0xd1, ext[inst->op], false, lhs, 0);
+            return;
+        }
+        encode(8, 0xc1, ext[inst->op], false, lhs, 1);
+        emit_byte(rhs->val);
+        return;
+    }
+    case I_SETCC:
+        encode(1, 0x0f90 | inst->cc, 0, false, lhs, 0);
+        return;
+    case I_JMP:
+        encode_jump(0xe9, lhs, false);
+        return;
+    case I_JCC:
+        encode_jump(0x0f80 | inst->cc, lhs, false);
+        return;
+    case I_CALL:
+        encode_jump(0xe8, lhs, true);
+        return;
+    case I_PUSH:
+        encode_push_pop(0x50, lhs->reg);
+        return;
+    case I_POP:
+        encode_push_pop(0x58, lhs->reg);
+        return;
+    case I_RET:
+        emit_byte(0xc3);
+        return;
+    case I_LABEL: {
+        Symbol *sym = get_symbol(lhs->name, lhs->num);
+        if (sym->sec != SEC_UNDEF) {
+            error("symbol %s is already defined", sym->name);
+        }
+        sym->sec = cur_sec;
+        sym->offset = sections[cur_sec].len;
+        return;
+    }
+    case I_GLOBAL:
+        get_symbol(lhs->name, lhs->num)->is_global = true;
+        return;
+    case I_DATA:
+        cur_sec = SEC_DATA;
+        return;
+    case I_TEXT:
+        cur_sec = SEC_TEXT;
+        return;
+    case I_ZERO:
+        for (long i = 0; i < lhs->val; i++) {
+            emit_byte(0);
+        }
+        return;
+    case I_ALIGN:
+        emit_nops(align_to(sections[cur_sec].len, lhs->val) - sections[cur_sec].len);
+        if (text_align < lhs->val) {
+            text_align = lhs->val;
+        }
+        return;
+    case I_BYTE:
+        emit_byte(lhs->val);
+        return;
+    }
+    error("cannot encode instruction %d", inst->op);
+}
+
+void reset_elf(void) {
+    for (int i = 0; symbols && i < symbols->len; i++) {
+        Symbol *sym = symbols->data[i];
+        free(sym->name);
+        free(sym);
+    }
+    if (symbols) {
+        symbols->len = 0;
+    }
+    memset(sym_table, 0, sizeof(sym_table));
+    for (int i = 0; i < sizeof(sections) / sizeof(*sections); i++) {
+        sections[i].len = 0;
+    }
+    cur_sec = SEC_TEXT;
+    text_align = 16;
+    num_fixups = 0;
+}
+
+// Symbols starting with ".L" are assembler-local and are referred to
+// through their section symbol.
+static bool is_temporary(Symbol *sym) {
+    return !strncmp(sym->name, ".L", 2);
+}
+
+static bool in_symtab(Symbol *sym) {
+    return sym->is_global || sym->sec == SEC_UNDEF || !is_temporary(sym);
+}
+
+static bool is_global_sym(Symbol *sym) {
+    return sym->is_global || sym->sec == SEC_UNDEF;
+}
+
+typedef struct {
+    char *data;
+    long len;
+    long cap;
+} Buffer;
+
+static long buf_add(Buffer *buf, void *data, long len) {
+    while (buf->cap - buf->len < len) {
+        buf->cap = buf->cap ? buf->cap * 2 : 4096;
+        buf->data = realloc(buf->data, buf->cap);
+    }
+    long offset = buf->len;
+    memcpy(buf->data + offset, data, len);
+    buf->len += len;
+    return offset;
+}
+
+static long buf_align(Buffer *buf, int align) {
+    static char zero[16];
+    buf_add(buf, zero, align_to(buf->len, align) - buf->len);
+    return buf->len;
+}
+
+// Resolves fixups against .text labels and writes the object file.
+void elf_write(void) {
+    // Symbol table: null, section symbols, locals, then globals.
+    Buffer symtab = {0};
+    Buffer strtab = {0};
+    buf_add(&strtab, "", 1);
+
+    Elf64_Sym sym0 = {0};
+    buf_add(&symtab, &sym0, sizeof(sym0));
+    for (int sec = SEC_TEXT; sec <= SEC_DATA; sec++) {
+        Elf64_Sym esym = {0};
+        esym.st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+        esym.st_shndx = sec;
+        buf_add(&symtab, &esym, sizeof(esym));
+    }
+
+    int nsyms = 3;
+    int first_global = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            first_global = nsyms;
+        }
+        for (int i = 0; symbols && i < symbols->len; i++) {
+            Symbol *sym = symbols->data[i];
+            if (!in_symtab(sym) || is_global_sym(sym) != pass) {
+                continue;
+            }
+            Elf64_Sym esym = {0};
+            esym.st_name = buf_add(&strtab, sym->name, strlen(sym->name) + 1);
+            esym.st_info = ELF64_ST_INFO(pass ? STB_GLOBAL : STB_LOCAL, STT_NOTYPE);
+            esym.st_shndx = sym->sec;
+            esym.st_value = sym->offset;
+            buf_add(&symtab, &esym, sizeof(esym));
+            sym->index = nsyms++;
+        }
+    }
+
+    // Patch or relocate every fixup.
+    Buffer rela = {0};
+    Section *text = &sections[SEC_TEXT];
+    for (int i = 0; i < num_fixups; i++) {
+        Fixup *fix = &fixups[i];
+        Symbol *sym = fix->sym;
+        if (sym->sec == SEC_TEXT && !sym->is_global) {
+            int val = sym->offset + fix->addend - fix->offset;
+            memcpy(text->data + fix->offset, &val, 4);
+            continue;
+        }
+
+        Elf64_Rela r = {0};
+        r.r_offset = fix->offset;
+        int type = fix->is_call ? R_X86_64_PLT32 : R_X86_64_PC32;
+        if (in_symtab(sym)) {
+            r.r_info = ELF64_R_INFO(sym->index, type);
+            r.r_addend = fix->addend;
+        } else {
+            r.r_info = ELF64_R_INFO(sym->sec, type);
+            r.r_addend = sym->offset + fix->addend;
+        }
+        buf_add(&rela, &r, sizeof(r));
+    }
+
+    static char shstrtab[] =
+        "\0.text\0.data\0.rela.text\0.symtab\0.strtab\0.shstrtab\0.note.GNU-stack";
+    enum { SH_NULL, SH_TEXT, SH_DATA, SH_RELA, SH_SYMTAB, SH_STRTAB, SH_SHSTRTAB, SH_NOTE, SH_NUM };
+
+    Buffer out = {0};
+    Elf64_Ehdr ehdr = {0};
+    buf_add(&out, &ehdr, sizeof(ehdr));
+
+    Elf64_Shdr shdr[SH_NUM] = {0};
+    shdr[SH_TEXT] = (Elf64_Shdr){.sh_name = 1, .sh_type = SHT_PROGBITS,
+        .sh_flags = SHF_ALLOC | SHF_EXECINSTR, .sh_addralign = text_align};
+    shdr[SH_DATA] = (Elf64_Shdr){.sh_name = 7, .sh_type = SHT_PROGBITS,
+        .sh_flags = SHF_ALLOC | SHF_WRITE, .sh_addralign = 16};
+    shdr[SH_RELA] = (Elf64_Shdr){.sh_name = 13, .sh_type = SHT_RELA, .sh_flags = SHF_INFO_LINK,
+        .sh_link = SH_SYMTAB, .sh_info = SH_TEXT, .sh_addralign = 8, .sh_entsize = sizeof(Elf64_Rela)};
+    shdr[SH_SYMTAB] = (Elf64_Shdr){.sh_name = 24, .sh_type = SHT_SYMTAB, .sh_link = SH_STRTAB,
+        .sh_info = first_global, .sh_addralign = 8, .sh_entsize = sizeof(Elf64_Sym)};
+    shdr[SH_STRTAB] = (Elf64_Shdr){.sh_name = 32, .sh_type = SHT_STRTAB, .sh_addralign = 1};
+    shdr[SH_SHSTRTAB] = (Elf64_Shdr){.sh_name = 40, .sh_type = SHT_STRTAB, .sh_addralign = 1};
+    shdr[SH_NOTE] = (Elf64_Shdr){.sh_name = 50, .sh_type = SHT_PROGBITS, .sh_addralign = 1};
+
+    struct {
+        int idx;
+        void *data;
+        long len;
+    } contents[] = {
+        {SH_TEXT, text->data, text->len},
+        {SH_DATA, sections[SEC_DATA].data, sections[SEC_DATA].len},
+        {SH_RELA, rela.data, rela.len},
+        {SH_SYMTAB, symtab.data, symtab.len},
+        {SH_STRTAB, strtab.data, strtab.len},
+        {SH_SHSTRTAB, shstrtab, sizeof(shstrtab)},
+    };
+    for (int i = 0; i < sizeof(contents) / sizeof(*contents); i++) {
+        Elf64_Shdr *sh = &shdr[contents[i].idx];
+        sh->sh_offset = buf_align(&out, sh->sh_addralign);
+        sh->sh_size = contents[i].len;
+        if (contents[i].len) {
+            buf_add(&out, contents[i].data, contents[i].len);
+        }
+    }
+    shdr[SH_NOTE].sh_offset = out.len;
+
+    long shoff = buf_align(&out, 8);
+    buf_add(&out, shdr, sizeof(shdr));
+
+    Elf64_Ehdr *eh = (Elf64_Ehdr *)out.data;
+    memcpy(eh->e_ident, ELFMAG, SELFMAG);
+    eh->e_ident[EI_CLASS] = ELFCLASS64;
+    eh->e_ident[EI_DATA] = ELFDATA2LSB;
+    eh->e_ident[EI_VERSION] = EV_CURRENT;
+    eh->e_type = ET_REL;
+    eh->e_machine = EM_X86_64;
+    eh->e_version = EV_CURRENT;
+    eh->e_shoff = shoff;
+    eh->e_ehsize = sizeof(Elf64_Ehdr);
+    eh->e_shentsize = sizeof(Elf64_Shdr);
+    eh->e_shnum = SH_NUM;
+    eh->e_shstrndx = SH_SHSTRTAB;
+
+    emit_raw(out.data, out.len);
+    free(out.data);
+    free(symtab.data);
+    free(strtab.data);
+    free(rela.data);
+}
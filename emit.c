@@ -0,0 +1,379 @@
+#include "9cc.h"
+
+// The emitter turns instructions built by codegen into assembly text,
+// or hands them to the ELF encoder when emit_obj is set. Output goes
+// through one large buffer that is written out in big chunks, and
+// registers, immediates and labels are formatted by hand instead of
+// through printf.
+
+char *outfile;
+bool emit_obj;
+
+static int outfd = 1;
+static char outbuf[1 << 20];
+static int outlen;
+static long written;
+
+// Buffer that receives this thread's output instead of outbuf.
+static _Thread_local EmitBuffer *capture;
+
+// Instructions of the function being generated, if they are held back.
+static _Thread_local InstList *held;
+
+static char *reg_names[][REG_NONE] = {
+    [1] = {"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+           "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b", "rip"},
+    [2] = {"ax", "cx", "dx", "bx", "sp", "bp", "si", "di",
+           "r8w", "r9w", "r10w", "r11w", "r12w", "r13w", "r14w", "r15w", "rip"},
+    [4] = {"eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi",
+           "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d", "rip"},
+    [8] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+           "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rip"},
+};
+
+static char *ptr_names[] = {
+    [1] = "byte ptr ", [2] = "word ptr ", [4] = "dword ptr ", [8] = "qword ptr ",
+};
+
+static char *cc_names[] = {
+    [CC_E] = "e", [CC_NE] = "ne", [CC_L] = "l", [CC_GE] = "ge", [CC_LE] = "le", [CC_G] = "g",
+};
+
+static char *op_names[] = {
+    [I_MOV] = "mov", [I_MOVSX] = "movsx", [I_MOVSXD] = "movsxd", [I_MOVZX] = "movzx",
+    [I_LEA] = "lea", [I_ADD] = "add", [I_SUB] = "sub", [I_IMUL] = "imul",
+    [I_CQO] = "cqo", [I_IDIV] = "idiv", [I_NEG] = "neg", [I_AND] = "and", [I_XOR] = "xor",
+    [I_SHL] = "shl", [I_SHR] = "shr", [I_SAR] = "sar", [I_CMP] = "cmp",
+    [I_SETCC] = "set", [I_JMP] = "jmp", [I_JCC] = "j", [I_CALL] = "call",
+    [I_PUSH] = "push", [I_POP] = "pop", [I_RET] = "ret",
+    [I_GLOBAL] = ".global", [I_DATA] = ".data", [I_TEXT] = ".text",
+    [I_ZERO] = ".zero", [I_BYTE] = ".byte", [I_ALIGN] = ".align",
+};
+
+Operand opd_reg(Reg reg, int size) {
+    Operand opd = {OPD_REG};
+    opd.reg = reg;
+    opd.size = size;
+    return opd;
+}
+
+Operand opd_imm(long val) {
+    Operand opd = {OPD_IMM};
+    opd.val = val;
+    return opd;
+}
+
+// Memory at [base+disp]. `size` is 0 when the width follows from the
+// other operand or does not matter (lea).
+Operand opd_mem(Reg base, long disp, int size) {
+    Operand opd = {OPD_MEM};
+    opd.reg = base;
+    opd.val = disp;
+    opd.size = size;
+    return opd;
+}
+
+// Memory at [base+index*scale], for scale 1, 2, 4 or 8.
+Operand opd_index(Reg base, Reg index, int scale, int size) {
+    Operand opd = opd_mem(base, 0, size);
+    opd.index = index;
+    opd.scale = scale;
+    return opd;
+}
+
+// Memory at [rip+name].
+Operand opd_sym(char *name, int size) {
+    Operand opd = opd_mem(REG_RIP, 0, size);
+    opd.name = name;
+    return opd;
+}
+
+Operand opd_label(char *name, int num) {
+    Operand opd = {OPD_LABEL};
+    opd.name = name;
+    opd.num = num;
+    return opd;
+}
+
+static void flush(void) {
+    char *p = outbuf;
+    while (outlen > 0) {
+        int n = write(outfd, p, outlen);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error("%s: write failed: %s", outfile ? outfile : "stdout", strerror(errno));
+        }
+        p += n;
+        outlen -= n;
+        written += n;
+    }
+}
+
+static void out_str(char *s) {
+    int len = strlen(s);
+    counters.bytes += len;
+    if (capture) {
+        if (capture->cap - capture->len < len) {
+            capture->cap = capture->cap ? capture->cap * 2 : 4096;
+            if (capture->cap < capture->len + len) {
+                capture->cap = capture->len + len;
+            }
+            capture->text = realloc(capture->text, capture->cap);
+        }
+        memcpy(capture->text + capture->len, s, len);
+        capture->len += len;
+        return;
+    }
+    if (sizeof(outbuf) - outlen < len) {
+        flush();
+    }
+    memcpy(outbuf + outlen, s, len);
+    outlen += len;
+}
+
+// Writes arbitrary bytes, such as an object file image.
+void emit_raw(char *data, long len) {
+    while (len > 0) {
+        if (outlen == sizeof(outbuf)) {
+            flush();
+        }
+        long n = sizeof(outbuf) - outlen;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(outbuf + outlen, data, n);
+        outlen += n;
+        data += n;
+        len -= n;
+    }
+}
+
+static void out_num(long val) {
+    char buf[24];
+    char *p = buf + sizeof(buf);
+    unsigned long u = val < 0 ? -(unsigned long)val : val;
+    *--p = '\0';
+    do {
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u);
+    if (val < 0) {
+        *--p = '-';
+    }
+    out_str(p);
+}
+
+static void out_label(char *name, int num) {
+    out_str(name);
+    if (num >= 0) {
+        out_num(num);
+    }
+}
+
+static void out_operand(Operand *opd) {
+    switch (opd->kind) {
+    case OPD_REG:
+        out_str(reg_names[opd->size][opd->reg]);
+        return;
+    case OPD_IMM:
+        out_num(opd->val);
+        return;
+    case OPD_MEM:
+        if (opd->size) {
+            out_str(ptr_names[opd->size]);
+        }
+        out_str("[");
+        out_str(reg_names[8][opd->reg]);
+        if (opd->scale) {
+            out_str("+");
+            out_str(reg_names[8][opd->index]);
+            out_str("*");
+            out_num(opd->scale);
+        }
+        if (opd->name) {
+            out_str("+");
+            out_str(opd->name);
+        }
+        if (opd->val > 0) {
+            out_str("+");
+        }
+        if (opd->val) {
+            out_num(opd->val);
+        }
+        out_str("]");
+        return;
+    case OPD_LABEL:
+        out_label(opd->name, opd->num);
+        return;
+    }
+}
+
+static void print_inst(Inst *inst) {
+    switch (inst->op) {
+    case I_LABEL:
+        out_label(inst->lhs.name, inst->lhs.num);
+        out_str(":\n");
+        return;
+    case I_DATA:
+    case I_TEXT:
+        out_str(op_names[inst->op]);
+        out_str("\n");
+        return;
+    case I_GLOBAL:
+    case I_ZERO:
+    case I_BYTE:
+    case I_ALIGN:
+        out_str(op_names[inst->op]);
+        out_str(" ");
+        out_operand(&inst->lhs);
+        out_str("\n");
+        return;
+    }
+
+    out_str("  ");
+    if (inst->op == I_MOV && inst->rhs.kind == OPD_IMM && inst->rhs.val != (int)inst->rhs.val) {
+        out_str("movabs");
+    } else {
+        out_str(op_names[inst->op]);
+    }
+    if (inst->op == I_SETCC || inst->op == I_JCC) {
+        out_str(cc_names[inst->cc]);
+    }
+    if (inst->lhs.kind != OPD_NONE) {
+        out_str(" ");
+        out_operand(&inst->lhs);
+    }
+    if (inst->rhs.kind != OPD_NONE) {
+        out_str(", ");
+        out_operand(&inst->rhs);
+    }
+    out_str("\n");
+}
+
+void emit_open(void) {
+    written = 0;
+    if (outfile) {
+        outfd = open(outfile, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (outfd < 0) {
+            error("cannot open %s: %s", outfile, strerror(errno));
+        }
+    }
+    if (!emit_obj) {
+        out_str(".intel_syntax noprefix\n");
+    }
+}
+
+void emit_close(void) {
+    if (emit_obj) {
+        elf_write();
+    }
+    flush();
+    if (outfd != 1) {
+        close(outfd);
+        outfd = 1;
+    }
+    report_output(written);
+}
+
+// Drops pending output after a failed compilation.
+void reset_emit(void) {
+    if (outfd != 1) {
+        close(outfd);
+        outfd = 1;
+    }
+    outlen = 0;
+    capture = NULL;
+    held = NULL;
+}
+
+static void put_inst(Inst *inst) {
+    if (capture && emit_obj) {
+        if (capture->num_insts == capture->cap_insts) {
+            capture->cap_insts = capture->cap_insts ? capture->cap_insts * 2 : 256;
+            capture->insts = realloc(capture->insts, sizeof(Inst) * capture->cap_insts);
+        }
+        capture->insts[capture->num_insts++] = *inst;
+    } else if (emit_obj) {
+        encode_inst(inst);
+    } else {
+        print_inst(inst);
+    }
+}
+
+static void emit_inst(Inst *inst) {
+    counters.insts++;
+    if (held) {
+        if (held->len == held->cap) {
+            held->cap = held->cap ? held->cap * 2 : 256;
+            held->insts = realloc(held->insts, sizeof(Inst) * held->cap);
+        }
+        held->insts[held->len++] = *inst;
+        return;
+    }
+    put_inst(inst);
+}
+
+// Makes the calling thread collect its instructions in `list` instead
+// of emitting them, or emit them again if `list` is NULL.
+void emit_hold(InstList *list) {
+    held = list;
+}
+
+// Emits the instructions in `list` and frees them.
+void emit_held(InstList *list) {
+    for (int i = 0; i < list->len; i++) {
+        put_inst(&list->insts[i]);
+    }
+    free(list->insts);
+}
+
+// Redirects the calling thread's output to `buf`, or back to the
+// output file if `buf` is NULL.
+void emit_capture(EmitBuffer *buf) {
+    capture = buf;
+}
+
+// Appends captured output to the output file and frees it.
+void emit_buffer(EmitBuffer *buf) {
+    if (emit_obj) {
+        for (int i = 0; i < buf->num_insts; i++) {
+            encode_inst(&buf->insts[i]);
+        }
+    } else {
+        emit_raw(buf->text, buf->len);
+    }
+    free(buf->text);
+    free(buf->insts);
+}
+
+void emit0(Op op) {
+    Inst inst = {op};
+    emit_inst(&inst);
+}
+
+void emit1(Op op, Operand lhs) {
+    Inst inst = {op};
+    inst.lhs = lhs;
+    emit_inst(&inst);
+}
+
+void emit2(Op op, Operand lhs, Operand rhs) {
+    Inst inst = {op};
+    inst.lhs = lhs;
+    inst.rhs = rhs;
+    emit_inst(&inst);
+}
+
+// Emits a jcc to label `lhs` or a setcc to register `lhs`.
+void emit_cc(Op op, Cond cc, Operand lhs) {
+    Inst inst = {op};
+    inst.cc = cc;
+    inst.lhs = lhs;
+    emit_inst(&inst);
+}
+
+void emit_label(char *name, int num) {
+    emit1(I_LABEL, opd_label(name, num));
+}
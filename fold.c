@@ -0,0 +1,224 @@
+#include "9cc.h"
+
+// Constant folding and algebraic simplification. Runs after add_type
+// and rewrites nodes in place, so links to the next statement or
+// argument are preserved when a node is replaced by one of its operands.
+
+static bool is_num(Node *node, long val) {
+    return node->kind == ND_NUM && node->val == val;
+}
+
+// Integer-typed operands can be simplified freely. Pointer arithmetic
+// is scaled by codegen and is left alone.
+static bool is_integer(Type *ty) {
+    switch (ty->kind) {
+    case TY_BOOL:
+    case TY_CHAR:
+    case TY_SHORT:
+    case TY_INT:
+    case TY_LONG:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool has_side_effects(Node *node) {
+    if (!node) {
+        return false;
+    }
+    switch (node->kind) {
+    case ND_ASSIGN:
+    case ND_FUNCALL:
+    case ND_STMT_EXPR:
+        return true;
+    default:
+        return has_side_effects(node->lhs) || has_side_effects(node->rhs);
+    }
+}
+
+// Replaces `node` with `with`, keeping node's place in its list.
+static void replace(Node *node, Node *with) {
+    Node *next = node->next;
+    *node = *with;
+    node->next = next;
+}
+
+static void set_num(Node *node, long val) {
+    node->kind = ND_NUM;
+    node->val = val;
+    node->lhs = node->rhs = NULL;
+}
+
+// Folds a binary operation on two constants. Arithmetic wraps in 64
+// bits like the generated code does.
+static bool fold_binary(Node *node) {
+    unsigned long a = node->lhs->val;
+    unsigned long b = node->rhs->val;
+    long x = node->lhs->val;
+    long y = node->rhs->val;
+
+    switch (node->kind) {
+    case ND_ADD:
+        set_num(node, a + b);
+        return true;
+    case ND_SUB:
+        set_num(node, a - b);
+        return true;
+    case ND_MUL:
+        set_num(node, a * b);
+        return true;
+    case ND_DIV:
+        if (y == 0 || (x == LONG_MIN && y == -1)) {
+            return false;
+        }
+        set_num(node, x / y);
+        return true;
+    case ND_EQ:
+        set_num(node, x == y);
+        return true;
+    case ND_NE:
+        set_num(node, x != y);
+        return true;
+    case ND_LT:
+        set_num(node, x < y);
+        return true;
+    case ND_LE:
+        set_num(node, x <= y);
+        return true;
+    }
+    return false;
+}
+
+static void simplify(Node *node) {
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+
+    switch (node->kind) {
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+        if (!is_integer(node->ty) || !is_integer(lhs->ty) || !is_integer(rhs->ty)) {
+            return;
+        }
+    }
+
+    switch (node->kind) {
+    case ND_ADD:
+        if (is_num(rhs, 0)) {
+            replace(node, lhs);
+        } else if (is_num(lhs, 0)) {
+            replace(node, rhs);
+        } else if (rhs->kind == ND_NUM && (lhs->kind == ND_ADD || lhs->kind == ND_SUB) &&
+                   lhs->rhs->kind == ND_NUM && is_integer(lhs->lhs->ty)) {
+            // (x + c1) + c2 => x + (c1 + c2), (x - c1) + c2 => x + (c2 - c1)
+            unsigned long c = lhs->rhs->val;
+            rhs->val = lhs->kind == ND_ADD ? c + rhs->val : rhs->val - c;
+            node->lhs = lhs->lhs;
+        }
+        return;
+    case ND_SUB:
+        if (is_num(rhs, 0)) {
+            replace(node, lhs);
+        } else if (rhs->kind == ND_NUM && (lhs->kind == ND_ADD || lhs->kind == ND_SUB) &&
+                   lhs->rhs->kind == ND_NUM && is_integer(lhs->lhs->ty)) {
+            // (x + c1) - c2 => x - (c2 - c1), (x - c1) - c2 => x - (c1 + c2)
+            unsigned long c = lhs->rhs->val;
+            rhs->val = lhs->kind == ND_ADD ? rhs->val - c : c + rhs->val;
+            node->lhs = lhs->lhs;
+        }
+        return;
+    case ND_MUL:
+        if (is_num(rhs, 1)) {
+            replace(node, lhs);
+        } else if (is_num(lhs, 1)) {
+            replace(node, rhs);
+        } else if ((is_num(rhs, 0) && !has_side_effects(lhs)) ||
+                   (is_num(lhs, 0) && !has_side_effects(rhs))) {
+            set_num(node, 0);
+        }
+        return;
+    case ND_DIV:
+        if (is_num(rhs, 1)) {
+            replace(node, lhs);
+        }
+        return;
+    }
+}
+
+// Rewrites statements whose condition is a constant.
+static void fold_control(Node *node) {
+    switch (node->kind) {
+    case ND_IF:
+        if (node->cond->kind != ND_NUM) {
+            return;
+        }
+        if (node->cond->val) {
+            replace(node, node->then);
+        } else if (node->els) {
+            replace(node, node->els);
+        } else {
+            node->kind = ND_NULL;
+        }
+        return;
+    case ND_WHILE:
+        if (node->cond->kind != ND_NUM) {
+            return;
+        }
+        if (node->cond->val) {
+            // An infinite loop; a for without a condition.
+            node->kind = ND_FOR;
+            node->cond = NULL;
+        } else {
+            node->kind = ND_NULL;
+        }
+        return;
+    case ND_FOR:
+        if (!node->cond || node->cond->kind != ND_NUM) {
+            return;
+        }
+        if (node->cond->val) {
+            node->cond = NULL;
+        } else if (node->init) {
+            replace(node, node->init);
+        } else {
+            node->kind = ND_NULL;
+        }
+        return;
+    }
+}
+
+static void fold_node(Node *node) {
+    if (!node) {
+        return;
+    }
+
+    fold_node(node->lhs);
+    fold_node(node->rhs);
+    fold_node(node->cond);
+    fold_node(node->then);
+    fold_node(node->els);
+    fold_node(node->init);
+    fold_node(node->inc);
+
+    for (Node *n = node->body; n; n = n->next) {
+        fold_node(n);
+    }
+    for (Node *n = node->args; n; n = n->next) {
+        fold_node(n);
+    }
+
+    if (node->lhs && node->rhs && node->lhs->kind == ND_NUM && node->rhs->kind == ND_NUM &&
+        !node->ty->base && fold_binary(node)) {
+        return;
+    }
+    simplify(node);
+    fold_control(node);
+}
+
+void fold(Function *fn) {
+    for (Node *node = fn->node; node; node = node->next) {
+        fold_node(node);
+    }
+}
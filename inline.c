@@ -0,0 +1,339 @@
+#include "9cc.h"
+
+// Function inlining. Runs on the whole program between the parser and
+// the backend, and replaces a call to a small function, or to a larger
+// one that is called only once, with a statement expression that does
+// the work of the call in the caller:
+//
+//   ({ p1 = a1; ...; body; join: ret; })
+//
+// The parameters and locals of the callee are copied into the caller's
+// locals, and every "return e" in the body becomes "ret = e; goto
+// join". Only functions defined earlier in the file are inlined, so a
+// callee has already had its own calls inlined and recursion stops by
+// itself. There is no `static`, so the callee is still emitted too.
+
+// How many times larger than -finline-limit a callee with a single
+// call site may be.
+#define SINGLE_CALL_FACTOR 4
+
+// The function whose calls are being inlined or hashed.
+static Function *caller;
+
+// Calls `visit` on every node under `node`, children first.
+static void walk(Node *node, void (*visit)(Node *)) {
+    if (!node) {
+        return;
+    }
+    // The operand of sizeof is not evaluated, and inlining a call there
+    // would change its type; see inline_call().
+    if (node->kind == ND_SIZEOF) {
+        visit(node);
+        return;
+    }
+    walk(node->lhs, visit);
+    walk(node->rhs, visit);
+    walk(node->cond, visit);
+    walk(node->then, visit);
+    walk(node->els, visit);
+    walk(node->init, visit);
+    walk(node->inc, visit);
+    for (Node *n = node->body; n; n = n->next) {
+        walk(n, visit);
+    }
+    for (Node *n = node->args; n; n = n->next) {
+        walk(n, visit);
+    }
+    visit(node);
+}
+
+static Function *callee_of(Node *call) {
+    return call->var ? call->var->fn : NULL;
+}
+
+// Cache key being extended by inline_key().
+static uint64_t key;
+
+static void hash_callee(Node *node) {
+    Function *callee = node->kind == ND_FUNCALL ? callee_of(node) : NULL;
+    if (!callee || callee == caller) {
+        return;
+    }
+    bool single = callee->num_calls == 1;
+    key = hash64(key, &callee->cache_key, sizeof(uint64_t));
+    key = hash64(key, &single, sizeof(single));
+}
+
+// Returns the cache key of `fn` extended with what decides which calls
+// are inlined into it: the keys of its callees, which cover their own
+// callees in turn, and whether each has a single call site.
+uint64_t inline_key(Function *fn) {
+    caller = fn;
+    key = fn->cache_key;
+    for (Node *node = fn->node; node; node = node->next) {
+        walk(node, hash_callee);
+    }
+    caller = NULL;
+    return key;
+}
+
+// Adds the nodes of `node` to `n`, giving up once it exceeds `max`.
+static int count_nodes(Node *node, int n, int max) {
+    if (!node || n > max) {
+        return n;
+    }
+    n++;
+    n = count_nodes(node->lhs, n, max);
+    n = count_nodes(node->rhs, n, max);
+    n = count_nodes(node->cond, n, max);
+    n = count_nodes(node->then, n, max);
+    n = count_nodes(node->els, n, max);
+    n = count_nodes(node->init, n, max);
+    n = count_nodes(node->inc, n, max);
+    for (Node *b = node->body; b; b = b->next) {
+        n = count_nodes(b, n, max);
+    }
+    for (Node *a = node->args; a; a = a->next) {
+        n = count_nodes(a, n, max);
+    }
+    return n;
+}
+
+// Whether a return appears inside a statement expression, which may
+// hold temporaries that a jump to the join label would leave behind.
+static bool return_in_expr(Node *node, bool in_expr) {
+    if (!node) {
+        return false;
+    }
+    if (node->kind == ND_RETURN && in_expr) {
+        return true;
+    }
+    in_expr = in_expr || node->kind == ND_STMT_EXPR;
+    if (return_in_expr(node->lhs, in_expr) || return_in_expr(node->rhs, in_expr) ||
+        return_in_expr(node->cond, in_expr) || return_in_expr(node->then, in_expr) ||
+        return_in_expr(node->els, in_expr) || return_in_expr(node->init, in_expr) ||
+        return_in_expr(node->inc, in_expr)) {
+        return true;
+    }
+    for (Node *n = node->body; n; n = n->next) {
+        if (return_in_expr(n, in_expr)) {
+            return true;
+        }
+    }
+    for (Node *n = node->args; n; n = n->next) {
+        if (return_in_expr(n, in_expr)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Parameters and return values go through a local variable, so they
+// must be something that fits in a register.
+static bool is_scalar(Type *ty) {
+    return ty->kind != TY_ARRAY && ty->kind != TY_STRUCT && ty->kind != TY_FUNC;
+}
+
+static bool can_inline(Node *call) {
+    Function *callee = callee_of(call);
+    if (!callee || callee == caller) {
+        return false;
+    }
+    if (call->ty->kind != TY_VOID && !is_scalar(call->ty)) {
+        return false;
+    }
+
+    VarList *param = callee->params;
+    for (Node *arg = call->args; arg; arg = arg->next) {
+        if (!param || !is_scalar(param->var->ty)) {
+            return false;
+        }
+        param = param->next;
+    }
+    if (param) {
+        return false;
+    }
+
+    // The out-of-line copy stays, so even a callee with a single call
+    // site only gets a larger budget. Otherwise each function of a call
+    // chain would absorb all of the ones before it.
+    int limit = opt_inline_limit;
+    if (callee->num_calls == 1) {
+        limit *= SINGLE_CALL_FACTOR;
+    }
+    int n = 0;
+    for (Node *node = callee->node; node; node = node->next) {
+        n = count_nodes(node, n, limit);
+    }
+    if (n > limit) {
+        return false;
+    }
+    for (Node *node = callee->node; node; node = node->next) {
+        if (return_in_expr(node, false)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// State of copying the body of a callee into the caller.
+typedef struct {
+    Function *callee;
+    Var **vars;     // the caller's copies of callee->locals, in order
+    Var *ret;       // receives the return value, or NULL for void
+    int labels;     // number of the callee's first label in the caller
+    int join;       // label that returns jump to
+    int gotos;      // jumps made to it
+} Copy;
+
+static Var *new_local(Type *ty, char *name) {
+    Var *var = arena_alloc(&node_arena, sizeof(Var));
+    var->name = name;
+    var->ty = ty;
+    var->is_local = true;
+    VarList *vl = arena_alloc(&node_arena, sizeof(VarList));
+    vl->var = var;
+    vl->next = caller->locals;
+    caller->locals = vl;
+    return var;
+}
+
+static Var *copy_var(Copy *c, Var *var) {
+    int i = 0;
+    for (VarList *vl = c->callee->locals; vl; vl = vl->next) {
+        if (vl->var == var) {
+            return c->vars[i];
+        }
+        i++;
+    }
+    error("%s: %s is not a local variable", c->callee->name, var->name);
+}
+
+static Node *copy_node(Copy *c, Node *node);
+
+static Node *copy_list(Copy *c, Node *list) {
+    Node head = {0};
+    Node *cur = &head;
+    for (Node *n = list; n; n = n->next) {
+        cur = cur->next = copy_node(c, n);
+    }
+    return head.next;
+}
+
+static Node *copy_node(Copy *c, Node *node) {
+    if (!node) {
+        return NULL;
+    }
+    Token *tok = node->tok;
+
+    if (node->kind == ND_RETURN) {
+        // return e => { ret = e; goto join; }
+        Node *val = copy_node(c, node->lhs);
+        if (c->ret) {
+            val = new_binary(ND_ASSIGN, new_node_Var(c->ret, tok), val, tok);
+        }
+        Node *jump = new_node(ND_GOTO, tok);
+        jump->val = c->join;
+        c->gotos++;
+
+        Node *block = new_node(ND_BLOCK, tok);
+        block->body = new_unary(ND_EXPR_STMT, val, tok);
+        block->body->next = jump;
+        return block;
+    }
+
+    Node *copy = new_node(node->kind, tok);
+    *copy = *node;
+    copy->next = NULL;
+    copy->lhs = copy_node(c, node->lhs);
+    copy->rhs = copy_node(c, node->rhs);
+    copy->cond = copy_node(c, node->cond);
+    copy->then = copy_node(c, node->then);
+    copy->els = copy_node(c, node->els);
+    copy->init = copy_node(c, node->init);
+    copy->inc = copy_node(c, node->inc);
+    copy->body = copy_list(c, node->body);
+    copy->args = copy_list(c, node->args);
+
+    if (node->kind == ND_VAR && node->var->is_local) {
+        copy->var = copy_var(c, node->var);
+    } else if (node->kind == ND_GOTO || node->kind == ND_LABEL) {
+        copy->val += c->labels;
+    }
+    return copy;
+}
+
+// Replaces `call` in place with the body of its callee.
+static void inline_call(Node *call) {
+    Function *callee = callee_of(call);
+    Token *tok = call->tok;
+
+    Copy c = {.callee = callee, .labels = caller->num_labels};
+    caller->num_labels += callee->num_labels;
+    c.join = caller->num_labels;
+
+    int nvars = 0;
+    for (VarList *vl = callee->locals; vl; vl = vl->next) {
+        nvars++;
+    }
+    c.vars = arena_alloc(&node_arena, sizeof(Var *) * (nvars + 1));
+    nvars = 0;
+    for (VarList *vl = callee->locals; vl; vl = vl->next) {
+        c.vars[nvars++] = new_local(vl->var->ty, vl->var->name);
+    }
+    // Out of line, a return value is not converted to the return type:
+    // the caller gets all of rax. An integer is returned through a long
+    // so that the inlined call gives the same value.
+    if (call->ty->kind == TY_PTR) {
+        c.ret = new_local(call->ty, callee->name);
+    } else if (call->ty->kind != TY_VOID) {
+        c.ret = new_local(long_type(), callee->name);
+    }
+
+    // The arguments are assigned to the parameters in order.
+    Node head = {0};
+    Node *cur = &head;
+    Node *arg = call->args;
+    for (VarList *vl = callee->params; vl; vl = vl->next) {
+        Node *next = arg->next;
+        arg->next = NULL;
+        Node *param = new_node_Var(copy_var(&c, vl->var), tok);
+        cur = cur->next = new_unary(ND_EXPR_STMT, new_binary(ND_ASSIGN, param, arg, tok), tok);
+        arg = next;
+    }
+
+    Node *last = NULL;
+    for (Node *n = callee->node; n; n = n->next) {
+        cur = cur->next = copy_node(&c, n);
+        last = n;
+    }
+    // A return at the end of the body falls through to the join.
+    if (last && last->kind == ND_RETURN) {
+        cur->body->next = NULL;
+        c.gotos--;
+    }
+    if (c.gotos) {
+        cur = cur->next = new_node(ND_LABEL, tok);
+        cur->val = caller->num_labels++;
+    }
+    cur->next = c.ret ? new_node_Var(c.ret, tok) : new_node_num(0, tok);
+
+    Node *next = call->next;
+    *call = (Node){.kind = ND_STMT_EXPR, .tok = tok, .body = head.next, .next = next};
+}
+
+static void inline_node(Node *node) {
+    if (node->kind == ND_FUNCALL && can_inline(node)) {
+        inline_call(node);
+    }
+}
+
+void inline_functions(Program *prog) {
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        caller = fn;
+        for (Node *node = fn->node; node; node = node->next) {
+            walk(node, inline_node);
+        }
+    }
+    caller = NULL;
+}
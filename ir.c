@@ -0,0 +1,685 @@
+#include "9cc.h"
+
+// Lowering of a function's AST to the IR, and the verifier and text
+// dump of the IR. Lowering gives every local variable an IR_ALLOCA that
+// is read and written through loads and stores, the way the stack
+// machine treats them; mem2reg() in ssa.c then turns the variables
+// whose address is never taken into SSA values.
+//
+// Integers and pointers are both 64 bits wide and the language has no
+// casts, so a value of either type may stand where the other is
+// expected. The type of a value only records what it was computed as.
+
+// Function and block being built.
+static _Thread_local IrFunc *func;
+static _Thread_local Block *cur;
+static _Thread_local Block *last_block;
+static _Thread_local Block **label_blocks;  // by ND_LABEL number
+
+IrType ir_type(Type *ty) {
+    if (ty && (ty->kind == TY_PTR || ty->kind == TY_ARRAY)) {
+        return IT_PTR;
+    }
+    return IT_I64;
+}
+
+// Returns `arr`, or a copy of it, with room for element `len`. Arrays
+// grow by doubling whenever `len` reaches a power of two.
+void *ir_grow(void *arr, int len, int size) {
+    if (len & (len - 1)) {
+        return arr;
+    }
+    void *p = arena_alloc(&ir_arena, size * (len ? len * 2 : 1));
+    if (len) {
+        memcpy(p, arr, size * len);
+    }
+    return p;
+}
+
+static void add_arg(IrInst *inst, IrInst *arg) {
+    inst->args = ir_grow(inst->args, inst->num_args, sizeof(IrInst *));
+    inst->args[inst->num_args++] = arg;
+}
+
+IrInst *new_inst(IrFunc *f, IrOp op, IrType ty) {
+    IrInst *inst = arena_alloc(&ir_arena, sizeof(IrInst));
+    inst->op = op;
+    inst->ty = ty;
+    inst->id = f->num_values++;
+    return inst;
+}
+
+static void append(Block *bb, IrInst *inst) {
+    inst->block = bb;
+    inst->prev = bb->last;
+    if (bb->last) {
+        bb->last->next = inst;
+    } else {
+        bb->first = inst;
+    }
+    bb->last = inst;
+}
+
+void insert_before(IrInst *pos, IrInst *inst) {
+    Block *bb = pos->block;
+    inst->block = bb;
+    inst->prev = pos->prev;
+    inst->next = pos;
+    if (pos->prev) {
+        pos->prev->next = inst;
+    } else {
+        bb->first = inst;
+    }
+    pos->prev = inst;
+}
+
+void remove_inst(IrInst *inst) {
+    Block *bb = inst->block;
+    if (inst->prev) {
+        inst->prev->next = inst->next;
+    } else {
+        bb->first = inst->next;
+    }
+    if (inst->next) {
+        inst->next->prev = inst->prev;
+    } else {
+        bb->last = inst->prev;
+    }
+    inst->block = NULL;
+}
+
+// Returns the value that stands for `v` after removed instructions
+// have been replaced.
+IrInst *resolve(IrInst *v) {
+    while (v->replaced) {
+        v = v->replaced;
+    }
+    return v;
+}
+
+void count_uses(IrFunc *f) {
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            inst->num_uses = 0;
+        }
+    }
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            for (int i = 0; i < inst->num_args; i++) {
+                inst->args[i]->num_uses++;
+            }
+        }
+    }
+}
+
+bool is_terminator(IrOp op) {
+    return op == IR_JMP || op == IR_BR || op == IR_RET;
+}
+
+//
+// Lowering
+//
+
+static Block *new_block(void) {
+    Block *bb = arena_alloc(&ir_arena, sizeof(Block));
+    bb->id = func->num_blocks++;
+    return bb;
+}
+
+// Makes `bb` the current block and places it after the others.
+static void start_block(Block *bb) {
+    if (last_block) {
+        last_block->next = bb;
+    } else {
+        func->blocks = bb;
+    }
+    last_block = bb;
+    cur = bb;
+}
+
+// Appends an instruction to the current block. Code that follows a
+// return is unreachable; it goes to a new block that is dropped later.
+static IrInst *emit_ir(IrOp op, IrType ty) {
+    if (cur->last && is_terminator(cur->last->op)) {
+        start_block(new_block());
+    }
+    IrInst *inst = new_inst(func, op, ty);
+    append(cur, inst);
+    return inst;
+}
+
+static IrInst *emit_const(long val) {
+    IrInst *inst = emit_ir(IR_CONST, IT_I64);
+    inst->imm = val;
+    return inst;
+}
+
+static IrInst *emit_binary(IrOp op, IrType ty, IrInst *lhs, IrInst *rhs) {
+    IrInst *inst = emit_ir(op, ty);
+    add_arg(inst, lhs);
+    add_arg(inst, rhs);
+    return inst;
+}
+
+static void emit_jmp(Block *to) {
+    emit_ir(IR_JMP, IT_VOID);
+    cur->succs[0] = to;
+    cur->num_succs = 1;
+}
+
+static Block *label_block(int id) {
+    if (!label_blocks[id]) {
+        label_blocks[id] = new_block();
+    }
+    return label_blocks[id];
+}
+
+static void emit_br(IrInst *cond, Block *then, Block *els) {
+    IrInst *inst = emit_ir(IR_BR, IT_VOID);
+    add_arg(inst, cond);
+    cur->succs[0] = then;
+    cur->succs[1] = els;
+    cur->num_succs = 2;
+}
+
+static int access_size(Node *node) {
+    int sz = size_of(node->ty);
+    if (sz != 1 && sz != 2 && sz != 4 && sz != 8) {
+        error_tok(node->tok, "cannot access a value of %d bytes", sz);
+    }
+    return sz;
+}
+
+static IrInst *emit_load(Node *node, IrInst *addr) {
+    // An array stands for its address.
+    if (node->ty->kind == TY_ARRAY) {
+        return addr;
+    }
+    IrInst *inst = emit_ir(IR_LOAD, ir_type(node->ty));
+    inst->size = access_size(node);
+    add_arg(inst, addr);
+    return inst;
+}
+
+static void emit_store(IrInst *addr, IrInst *val, int size) {
+    IrInst *inst = emit_ir(IR_STORE, IT_VOID);
+    inst->size = size;
+    add_arg(inst, addr);
+    add_arg(inst, val);
+}
+
+static IrInst *lower_expr(Node *node);
+static void lower_stmt(Node *node);
+
+static IrInst *lower_addr(Node *node) {
+    switch (node->kind) {
+    case ND_VAR:
+        if (node->var->is_local) {
+            return node->var->ir;
+        } else {
+            IrInst *inst = emit_ir(IR_GLOBAL, IT_PTR);
+            inst->name = node->var->name;
+            return inst;
+        }
+    case ND_DEREF:
+        return lower_expr(node->lhs);
+    case ND_MEMBER: {
+        IrInst *base = lower_addr(node->lhs);
+        if (!node->member->offset) {
+            return base;
+        }
+        return emit_binary(IR_ADD, IT_PTR, base, emit_const(node->member->offset));
+    }
+    }
+    error_tok(node->tok, "not an lvalue");
+}
+
+static IrInst *lower_expr(Node *node) {
+    switch (node->kind) {
+    case ND_NUM:
+        return emit_const(node->val);
+    case ND_VAR:
+    case ND_MEMBER:
+        return emit_load(node, lower_addr(node));
+    case ND_DEREF:
+        return emit_load(node, lower_expr(node->lhs));
+    case ND_ADDR:
+        return lower_addr(node->lhs);
+    case ND_ASSIGN: {
+        if (node->lhs->ty->kind == TY_ARRAY) {
+            error_tok(node->tok, "not an lvalue");
+        }
+        IrInst *addr = lower_addr(node->lhs);
+        IrInst *val = lower_expr(node->rhs);
+        if (node->ty->kind == TY_BOOL) {
+            val = emit_binary(IR_NE, IT_I64, val, emit_const(0));
+        }
+        emit_store(addr, val, access_size(node));
+        return val;
+    }
+    case ND_FUNCALL: {
+        IrInst *args[6];
+        int nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next) {
+            if (nargs == 6) {
+                error_tok(arg->tok, "too many arguments");
+            }
+            args[nargs++] = lower_expr(arg);
+        }
+        IrInst *inst = emit_ir(IR_CALL, ir_type(node->ty));
+        inst->name = node->funcname;
+        inst->variadic = !node->has_prototype;
+        for (int i = 0; i < nargs; i++) {
+            add_arg(inst, args[i]);
+        }
+        return inst;
+    }
+    case ND_STMT_EXPR: {
+        // The parser has replaced the last statement by its expression.
+        Node *n = node->body;
+        for (; n->next; n = n->next) {
+            lower_stmt(n);
+        }
+        return lower_expr(n);
+    }
+    }
+
+    IrInst *lhs = lower_expr(node->lhs);
+    IrInst *rhs = lower_expr(node->rhs);
+
+    switch (node->kind) {
+    case ND_ADD:
+    case ND_SUB: {
+        IrOp op = node->kind == ND_ADD ? IR_ADD : IR_SUB;
+        if (node->ty->base) {
+            rhs = emit_binary(IR_MUL, IT_I64, rhs, emit_const(size_of(node->ty->base)));
+            return emit_binary(op, IT_PTR, lhs, rhs);
+        }
+        return emit_binary(op, IT_I64, lhs, rhs);
+    }
+    case ND_MUL:
+        return emit_binary(IR_MUL, IT_I64, lhs, rhs);
+    case ND_DIV:
+        return emit_binary(IR_DIV, IT_I64, lhs, rhs);
+    case ND_EQ:
+        return emit_binary(IR_EQ, IT_I64, lhs, rhs);
+    case ND_NE:
+        return emit_binary(IR_NE, IT_I64, lhs, rhs);
+    case ND_LT:
+        return emit_binary(IR_LT, IT_I64, lhs, rhs);
+    case ND_LE:
+        return emit_binary(IR_LE, IT_I64, lhs, rhs);
+    }
+    error_tok(node->tok, "invalid expression");
+}
+
+static void lower_stmt(Node *node) {
+    switch (node->kind) {
+    case ND_NULL:
+        return;
+    case ND_EXPR_STMT:
+        lower_expr(node->lhs);
+        return;
+    case ND_RETURN: {
+        IrInst *val = lower_expr(node->lhs);
+        add_arg(emit_ir(IR_RET, IT_VOID), val);
+        return;
+    }
+    case ND_IF: {
+        Block *then = new_block();
+        Block *els = node->els ? new_block() : NULL;
+        Block *end = new_block();
+        emit_br(lower_expr(node->cond), then, els ? els : end);
+        start_block(then);
+        lower_stmt(node->then);
+        emit_jmp(end);
+        if (els) {
+            start_block(els);
+            lower_stmt(node->els);
+            emit_jmp(end);
+        }
+        start_block(end);
+        return;
+    }
+    case ND_WHILE:
+    case ND_FOR: {
+        Block *begin = new_block();
+        Block *body = new_block();
+        Block *end = new_block();
+        begin->is_loop = true;
+        if (node->init) {
+            lower_stmt(node->init);
+        }
+        emit_jmp(begin);
+        start_block(begin);
+        if (node->cond) {
+            emit_br(lower_expr(node->cond), body, end);
+        } else {
+            emit_jmp(body);
+        }
+        start_block(body);
+        lower_stmt(node->then);
+        if (node->inc) {
+            lower_stmt(node->inc);
+        }
+        emit_jmp(begin);
+        start_block(end);
+        return;
+    }
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next) {
+            lower_stmt(n);
+        }
+        return;
+    case ND_GOTO:
+        emit_jmp(label_block(node->val));
+        return;
+    case ND_LABEL: {
+        Block *bb = label_block(node->val);
+        emit_jmp(bb);
+        start_block(bb);
+        return;
+    }
+    }
+    lower_expr(node);
+}
+
+// Drops the blocks that cannot be reached from the entry, numbers the
+// others in layout order and records their predecessors.
+static void link_blocks(IrFunc *f) {
+    bool *seen = calloc(f->num_blocks, sizeof(bool));
+    Block **stack = calloc(f->num_blocks, sizeof(Block *));
+    int sp = 0;
+    stack[sp++] = f->blocks;
+    seen[f->blocks->id] = true;
+    while (sp > 0) {
+        Block *bb = stack[--sp];
+        for (int i = 0; i < bb->num_succs; i++) {
+            Block *succ = bb->succs[i];
+            if (!seen[succ->id]) {
+                seen[succ->id] = true;
+                stack[sp++] = succ;
+            }
+        }
+    }
+
+    int n = 0;
+    for (Block **p = &f->blocks; *p;) {
+        Block *bb = *p;
+        if (!seen[bb->id]) {
+            *p = bb->next;
+            continue;
+        }
+        bb->id = n++;
+        p = &bb->next;
+    }
+    f->num_blocks = n;
+    free(seen);
+    free(stack);
+
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (int i = 0; i < bb->num_succs; i++) {
+            Block *succ = bb->succs[i];
+            succ->preds = ir_grow(succ->preds, succ->num_preds, sizeof(Block *));
+            succ->preds[succ->num_preds++] = bb;
+        }
+    }
+}
+
+IrFunc *lower(Function *fn) {
+    func = arena_alloc(&ir_arena, sizeof(IrFunc));
+    func->fn = fn;
+    last_block = NULL;
+    label_blocks = arena_alloc(&ir_arena, sizeof(Block *) * (fn->num_labels + 1));
+    start_block(new_block());
+
+    IrInst *params[6];
+    int nparams = 0;
+    for (VarList *vl = fn->params; vl; vl = vl->next) {
+        if (nparams == 6) {
+            error("%s: too many parameters", fn->name);
+        }
+        IrInst *inst = emit_ir(IR_PARAM, ir_type(vl->var->ty));
+        inst->imm = nparams;
+        params[nparams++] = inst;
+    }
+    for (VarList *vl = fn->locals; vl; vl = vl->next) {
+        IrInst *inst = emit_ir(IR_ALLOCA, IT_PTR);
+        inst->var = vl->var;
+        vl->var->ir = inst;
+    }
+    int i = 0;
+    for (VarList *vl = fn->params; vl; vl = vl->next) {
+        int sz = size_of(vl->var->ty);
+        emit_store(vl->var->ir, params[i++], sz);
+    }
+
+    for (Node *node = fn->node; node; node = node->next) {
+        lower_stmt(node);
+    }
+    // Falling off the end of a function returns 0.
+    add_arg(emit_ir(IR_RET, IT_VOID), emit_const(0));
+
+    link_blocks(func);
+    return func;
+}
+
+//
+// Verifier
+//
+
+static void invalid(IrFunc *f, char *pass, IrInst *inst, char *fmt, ...) {
+    fprintf(stderr, "%s: invalid IR after %s: ", f->fn->name, pass);
+    if (inst) {
+        fprintf(stderr, "bb%d: %%%d: ", inst->block->id, inst->id);
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+    fprintf(stderr, "\n");
+    dump_ir(f, stderr);
+    die();
+}
+
+// Number of arguments of each op, or -1 if it varies.
+static int num_args[] = {
+    [IR_CONST] = 0, [IR_PARAM] = 0, [IR_ALLOCA] = 0, [IR_GLOBAL] = 0,
+    [IR_LOAD] = 1, [IR_STORE] = 2, [IR_ADD] = 2, [IR_SUB] = 2, [IR_MUL] = 2,
+    [IR_DIV] = 2, [IR_EQ] = 2, [IR_NE] = 2, [IR_LT] = 2, [IR_LE] = 2,
+    [IR_SEXT] = 1, [IR_CALL] = -1, [IR_PHI] = -1, [IR_JMP] = 0, [IR_BR] = 1, [IR_RET] = 1,
+};
+
+static int count_succ(Block *from, Block *to) {
+    int n = 0;
+    for (int i = 0; i < from->num_succs; i++) {
+        n += from->succs[i] == to;
+    }
+    return n;
+}
+
+static int count_pred(Block *to, Block *from) {
+    int n = 0;
+    for (int i = 0; i < to->num_preds; i++) {
+        n += to->preds[i] == from;
+    }
+    return n;
+}
+
+// Checks the structure of the CFG and that every value is defined
+// before each of its uses. `pass` names the pass that ran last.
+void verify_ir(IrFunc *f, char *pass) {
+    compute_dominators(f);
+
+    // Instructions of the function by id, and their index in their block.
+    IrInst **defs = calloc(f->num_values, sizeof(IrInst *));
+    int *pos = calloc(f->num_values, sizeof(int));
+    int n = 0;
+    for (Block *bb = f->blocks; bb; bb = bb->next, n++) {
+        if (bb->id != n) {
+            invalid(f, pass, NULL, "bb%d is numbered %d", n, bb->id);
+        }
+        if (n > 0 && !bb->idom) {
+            invalid(f, pass, NULL, "bb%d is unreachable", n);
+        }
+        int i = 0;
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            if (inst->block != bb || inst->id < 0 || inst->id >= f->num_values ||
+                defs[inst->id]) {
+                invalid(f, pass, NULL, "bb%d: bad instruction %%%d", n, inst->id);
+            }
+            defs[inst->id] = inst;
+            pos[inst->id] = i++;
+        }
+    }
+    if (n != f->num_blocks || f->blocks->num_preds) {
+        invalid(f, pass, NULL, "bad block list");
+    }
+
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        if (!bb->last || !is_terminator(bb->last->op)) {
+            invalid(f, pass, NULL, "bb%d does not end with a terminator", bb->id);
+        }
+        int want = bb->last->op == IR_JMP ? 1 : bb->last->op == IR_BR ? 2 : 0;
+        if (bb->num_succs != want) {
+            invalid(f, pass, bb->last, "%d successors", bb->num_succs);
+        }
+        for (int i = 0; i < bb->num_succs; i++) {
+            Block *succ = bb->succs[i];
+            if (count_pred(succ, bb) != count_succ(bb, succ)) {
+                invalid(f, pass, bb->last, "bb%d does not list bb%d as a predecessor", succ->id,
+                        bb->id);
+            }
+        }
+        for (int i = 0; i < bb->num_preds; i++) {
+            if (!count_succ(bb->preds[i], bb)) {
+                invalid(f, pass, NULL, "bb%d is not a successor of bb%d", bb->id,
+                        bb->preds[i]->id);
+            }
+        }
+
+        bool phis = true;
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            if (inst->op != IR_PHI) {
+                phis = false;
+            } else if (!phis) {
+                invalid(f, pass, inst, "phi after other instructions");
+            }
+            if (is_terminator(inst->op) != (inst == bb->last)) {
+                invalid(f, pass, inst, "terminator in the middle of a block");
+            }
+            if ((inst->ty == IT_VOID) != (inst->op == IR_STORE || is_terminator(inst->op))) {
+                invalid(f, pass, inst, "wrong result type");
+            }
+
+            int want = inst->op == IR_PHI ? bb->num_preds : num_args[inst->op];
+            if (inst->op == IR_CALL ? inst->num_args > 6 : inst->num_args != want) {
+                invalid(f, pass, inst, "%d arguments", inst->num_args);
+            }
+            if (inst->op == IR_LOAD || inst->op == IR_STORE || inst->op == IR_SEXT) {
+                int sz = inst->size;
+                if (sz != 1 && sz != 2 && sz != 4 && (sz != 8 || inst->op == IR_SEXT)) {
+                    invalid(f, pass, inst, "access size %d", sz);
+                }
+            }
+
+            for (int i = 0; i < inst->num_args; i++) {
+                IrInst *arg = inst->args[i];
+                if (!arg || arg->id < 0 || arg->id >= f->num_values || defs[arg->id] != arg) {
+                    invalid(f, pass, inst, "argument %d is not an instruction of the function", i);
+                }
+                if (arg->ty == IT_VOID) {
+                    invalid(f, pass, inst, "argument %d has no value", i);
+                }
+                // Incoming values of a phi must be available at the end
+                // of the corresponding predecessor.
+                Block *use = inst->op == IR_PHI ? bb->preds[i] : bb;
+                bool ok = arg->block == use ? inst->op == IR_PHI || pos[arg->id] < pos[inst->id]
+                                            : dominates(arg->block, use);
+                if (!ok) {
+                    invalid(f, pass, inst, "%%%d does not dominate its use", arg->id);
+                }
+            }
+        }
+    }
+    free(defs);
+    free(pos);
+}
+
+//
+// Dump
+//
+
+static char *op_names[] = {
+    [IR_CONST] = "const", [IR_PARAM] = "param", [IR_ALLOCA] = "alloca",
+    [IR_GLOBAL] = "global", [IR_LOAD] = "load", [IR_STORE] = "store", [IR_ADD] = "add",
+    [IR_SUB] = "sub", [IR_MUL] = "mul", [IR_DIV] = "div", [IR_EQ] = "eq", [IR_NE] = "ne",
+    [IR_LT] = "lt", [IR_LE] = "le", [IR_SEXT] = "sext", [IR_CALL] = "call", [IR_PHI] = "phi",
+    [IR_JMP] = "jmp", [IR_BR] = "br", [IR_RET] = "ret",
+};
+
+static char *type_names[] = {[IT_I64] = "i64", [IT_PTR] = "ptr"};
+
+static void dump_inst(IrInst *inst, FILE *fp) {
+    fprintf(fp, "  ");
+    if (inst->ty != IT_VOID) {
+        fprintf(fp, "%%%d:%s = ", inst->id, type_names[inst->ty]);
+    }
+    fprintf(fp, "%s", op_names[inst->op]);
+    if (inst->size) {
+        fprintf(fp, ".%d", inst->size);
+    }
+
+    Block *bb = inst->block;
+    switch (inst->op) {
+    case IR_CONST:
+    case IR_PARAM:
+        fprintf(fp, " %ld\n", inst->imm);
+        return;
+    case IR_ALLOCA:
+        fprintf(fp, " %s, %d\n", inst->var->name, size_of(inst->var->ty));
+        return;
+    case IR_GLOBAL:
+        fprintf(fp, " @%s\n", inst->name);
+        return;
+    case IR_CALL:
+        fprintf(fp, " @%s(", inst->name);
+        for (int i = 0; i < inst->num_args; i++) {
+            fprintf(fp, "%s%%%d", i ? ", " : "", inst->args[i]->id);
+        }
+        fprintf(fp, ")\n");
+        return;
+    case IR_PHI:
+        for (int i = 0; i < inst->num_args; i++) {
+            fprintf(fp, "%s [%%%d, bb%d]", i ? "," : "", inst->args[i]->id, bb->preds[i]->id);
+        }
+        fprintf(fp, "\n");
+        return;
+    case IR_JMP:
+        fprintf(fp, " bb%d\n", bb->succs[0]->id);
+        return;
+    case IR_BR:
+        fprintf(fp, " %%%d, bb%d, bb%d\n", inst->args[0]->id, bb->succs[0]->id,
+                bb->succs[1]->id);
+        return;
+    }
+    for (int i = 0; i < inst->num_args; i++) {
+        fprintf(fp, "%s%%%d", i ? ", " : " ", inst->args[i]->id);
+    }
+    fprintf(fp, "\n");
+}
+
+void dump_ir(IrFunc *f, FILE *fp) {
+    fprintf(fp, "function %s\n", f->fn->name);
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        fprintf(fp, "bb%d:", bb->id);
+        for (int i = 0; i < bb->num_preds; i++) {
+            fprintf(fp, "%s bb%d", i ? "," : " ; preds", bb->preds[i]->id);
+        }
+        fprintf(fp, "\n");
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            dump_inst(inst, fp);
+        }
+    }
+    fprintf(fp, "\n");
+}
@@ -0,0 +1,381 @@
+#include "9cc.h"
+
+// Instruction selection from the IR. Until there is a register
+// allocator, every value lives in its own 8-byte frame slot; an
+// instruction loads its operands into rax and rcx, computes, and stores
+// the result back. Constants become immediates, allocas and globals are
+// folded into the addressing of loads and stores, and a comparison used
+// only by the branch that ends its block is fused with it into cmp/jcc.
+//
+// Phis are resolved on the edges into their block. A jump sets them
+// just before it leaves; a conditional branch goes through a stub that
+// sets them, so they never change on the way to the other successor.
+
+static Reg argreg[] = {REG_RDI, REG_RSI, REG_RDX, REG_RCX, REG_R8, REG_R9};
+
+static Cond cond_of[] = {[IR_EQ] = CC_E, [IR_NE] = CC_NE, [IR_LT] = CC_L, [IR_LE] = CC_LE};
+
+// Edge from a conditional branch into a block with phis.
+typedef struct Edge Edge;
+struct Edge {
+    Edge *next;
+    Block *from;
+    Block *to;
+    int num;
+};
+
+static _Thread_local char *block_label;
+static _Thread_local char *edge_label;
+static _Thread_local char *return_label;
+static _Thread_local Edge *edges;
+static _Thread_local Edge **last_edge;
+static _Thread_local int num_edges;
+
+static Operand rax(void) {
+    return opd_reg(REG_RAX, 8);
+}
+
+static bool is_compare(IrInst *inst) {
+    return IR_EQ <= inst->op && inst->op <= IR_LE;
+}
+
+static bool is_fused(IrInst *inst) {
+    IrInst *br = inst->block->last;
+    return is_compare(inst) && inst->num_uses == 1 && br->op == IR_BR && br->args[0] == inst;
+}
+
+static bool has_slot(IrInst *inst) {
+    switch (inst->op) {
+    case IR_CONST:
+    case IR_ALLOCA:
+    case IR_GLOBAL:
+        return false;
+    }
+    return inst->ty != IT_VOID && !is_fused(inst);
+}
+
+static Operand slot(IrInst *inst) {
+    return opd_mem(REG_RBP, -inst->slot, 8);
+}
+
+// Assigns frame offsets to the allocas that are left and to values.
+static void layout(IrFunc *f) {
+    int offset = 0;
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            if (inst->op == IR_ALLOCA) {
+                Var *var = inst->var;
+                offset = align_to(offset, var->ty->align);
+                offset += size_of(var->ty);
+                inst->slot = var->offset = offset;
+            }
+        }
+    }
+    offset = align_to(offset, 8);
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            if (has_slot(inst)) {
+                offset += 8;
+                inst->slot = offset;
+            }
+        }
+    }
+    f->fn->stack_size = align_to(offset, 16);
+}
+
+static void load_reg(Reg reg, IrInst *val) {
+    Operand rd = opd_reg(reg, 8);
+    switch (val->op) {
+    case IR_CONST:
+        emit2(I_MOV, rd, opd_imm(val->imm));
+        return;
+    case IR_ALLOCA:
+        emit2(I_LEA, rd, opd_mem(REG_RBP, -val->slot, 0));
+        return;
+    case IR_GLOBAL:
+        emit2(I_LEA, rd, opd_sym(val->name, 0));
+        return;
+    }
+    emit2(I_MOV, rd, slot(val));
+}
+
+// Returns `val` as the source operand of an ALU instruction, loading
+// it into `scratch` if it is neither an immediate nor in a slot.
+static Operand operand(IrInst *val, Reg scratch) {
+    if (val->op == IR_CONST && val->imm == (int)val->imm) {
+        return opd_imm(val->imm);
+    }
+    if (has_slot(val)) {
+        return slot(val);
+    }
+    load_reg(scratch, val);
+    return opd_reg(scratch, 8);
+}
+
+// Returns the memory operand at address `addr`, using rcx if needed.
+static Operand address(IrInst *addr, int size) {
+    switch (addr->op) {
+    case IR_ALLOCA:
+        return opd_mem(REG_RBP, -addr->slot, size);
+    case IR_GLOBAL:
+        return opd_sym(addr->name, size);
+    }
+    load_reg(REG_RCX, addr);
+    return opd_mem(REG_RCX, 0, size);
+}
+
+static void result(IrInst *inst) {
+    emit2(I_MOV, slot(inst), rax());
+}
+
+static bool has_phis(Block *bb) {
+    return bb->first->op == IR_PHI;
+}
+
+// Sets the phis of `to` to their values on the edge from `from`.
+static void copy_phis(Block *from, Block *to) {
+    int j = 0;
+    while (to->preds[j] != from) {
+        j++;
+    }
+
+    IrInst *last = to->first;
+    while (last->next->op == IR_PHI) {
+        last = last->next;
+    }
+    if (last == to->first) {
+        if (last->args[j] != last) {
+            load_reg(REG_RAX, last->args[j]);
+            result(last);
+        }
+        return;
+    }
+
+    // The phis are set at once: one may be the incoming value of another,
+    // so all of them are read before any is written.
+    for (IrInst *phi = to->first; phi != last->next; phi = phi->next) {
+        load_reg(REG_RAX, phi->args[j]);
+        emit1(I_PUSH, rax());
+    }
+    for (IrInst *phi = last; phi; phi = phi == to->first ? NULL : phi->prev) {
+        emit1(I_POP, rax());
+        result(phi);
+    }
+}
+
+// Returns the jump target for the edge from a conditional branch.
+static Operand target(Block *from, Block *to) {
+    if (!has_phis(to)) {
+        return opd_label(block_label, to->id);
+    }
+    Edge *e = arena_alloc(&ir_arena, sizeof(Edge));
+    e->from = from;
+    e->to = to;
+    e->num = num_edges++;
+    *last_edge = e;
+    last_edge = &e->next;
+    return opd_label(edge_label, e->num);
+}
+
+static void jump(Block *from, Block *to) {
+    if (has_phis(to)) {
+        copy_phis(from, to);
+    }
+    if (to != from->next) {
+        emit1(I_JMP, opd_label(block_label, to->id));
+    }
+}
+
+static void isel_branch(Block *bb, IrInst *cond) {
+    Block *then = bb->succs[0];
+    Block *els = bb->succs[1];
+    if (cond->op == IR_CONST) {
+        jump(bb, cond->imm ? then : els);
+        return;
+    }
+
+    Cond cc = CC_NE;
+    if (is_fused(cond)) {
+        load_reg(REG_RAX, cond->args[0]);
+        emit2(I_CMP, rax(), operand(cond->args[1], REG_RCX));
+        cc = cond_of[cond->op];
+    } else {
+        emit2(I_CMP, operand(cond, REG_RAX), opd_imm(0));
+    }
+
+    Operand t = target(bb, then);
+    Operand e = target(bb, els);
+    if (then == bb->next && !has_phis(then)) {
+        emit_cc(I_JCC, cc ^ 1, e);
+        return;
+    }
+    emit_cc(I_JCC, cc, t);
+    if (els != bb->next || has_phis(els)) {
+        emit1(I_JMP, e);
+    }
+}
+
+static void isel_inst(IrInst *inst) {
+    Block *bb = inst->block;
+    IrInst **args = inst->args;
+
+    switch (inst->op) {
+    case IR_CONST:
+    case IR_ALLOCA:
+    case IR_GLOBAL:
+    case IR_PHI:
+        return;
+    case IR_PARAM:
+        emit2(I_MOV, slot(inst), opd_reg(argreg[inst->imm], 8));
+        return;
+    case IR_LOAD: {
+        Operand addr = address(args[0], inst->size);
+        if (inst->size == 1 || inst->size == 2) {
+            emit2(I_MOVSX, rax(), addr);
+        } else if (inst->size == 4) {
+            emit2(I_MOVSXD, rax(), addr);
+        } else {
+            emit2(I_MOV, rax(), addr);
+        }
+        result(inst);
+        return;
+    }
+    case IR_STORE: {
+        Operand addr = address(args[0], inst->size);
+        IrInst *val = args[1];
+        if (val->op == IR_CONST && val->imm == (int)val->imm) {
+            long imm = val->imm;
+            if (inst->size == 1) {
+                imm = (signed char)imm;
+            } else if (inst->size == 2) {
+                imm = (short)imm;
+            }
+            emit2(I_MOV, addr, opd_imm(imm));
+            return;
+        }
+        load_reg(REG_RAX, val);
+        emit2(I_MOV, addr, opd_reg(REG_RAX, inst->size));
+        return;
+    }
+    case IR_ADD:
+    case IR_SUB:
+    case IR_MUL: {
+        static Op ops[] = {[IR_ADD] = I_ADD, [IR_SUB] = I_SUB, [IR_MUL] = I_IMUL};
+        if (inst->op == IR_MUL && args[1]->op == IR_CONST) {
+            load_reg(REG_RCX, args[0]);
+            mul_imm(REG_RCX, args[1]->imm);
+            emit2(I_MOV, slot(inst), opd_reg(REG_RCX, 8));
+            return;
+        }
+        load_reg(REG_RAX, args[0]);
+        emit2(ops[inst->op], rax(), operand(args[1], REG_RCX));
+        result(inst);
+        return;
+    }
+    case IR_DIV: {
+        if (args[1]->op == IR_CONST && args[1]->imm) {
+            load_reg(REG_RCX, args[0]);
+            div_imm(REG_RCX, args[1]->imm);
+            emit2(I_MOV, slot(inst), opd_reg(REG_RCX, 8));
+            return;
+        }
+        load_reg(REG_RAX, args[0]);
+        emit0(I_CQO);
+        Operand divisor = operand(args[1], REG_RCX);
+        if (divisor.kind == OPD_IMM) {
+            emit2(I_MOV, opd_reg(REG_RCX, 8), divisor);
+            divisor = opd_reg(REG_RCX, 8);
+        }
+        emit1(I_IDIV, divisor);
+        result(inst);
+        return;
+    }
+    case IR_EQ:
+    case IR_NE:
+    case IR_LT:
+    case IR_LE:
+        if (is_fused(inst)) {
+            return;
+        }
+        load_reg(REG_RAX, args[0]);
+        emit2(I_CMP, rax(), operand(args[1], REG_RCX));
+        emit_cc(I_SETCC, cond_of[inst->op], opd_reg(REG_RAX, 1));
+        emit2(I_MOVZX, rax(), opd_reg(REG_RAX, 1));
+        result(inst);
+        return;
+    case IR_SEXT:
+        load_reg(REG_RAX, args[0]);
+        if (inst->size == 4) {
+            emit2(I_MOVSXD, rax(), opd_reg(REG_RAX, 4));
+        } else {
+            emit2(I_MOVSX, rax(), opd_reg(REG_RAX, inst->size));
+        }
+        result(inst);
+        return;
+    case IR_CALL:
+        for (int i = 0; i < inst->num_args; i++) {
+            load_reg(argreg[i], args[i]);
+        }
+        // AL is the number of vector registers used by a variadic
+        // callee. The frame size is a multiple of 16, so RSP is already
+        // aligned.
+        if (inst->variadic) {
+            emit2(I_XOR, opd_reg(REG_RAX, 4), opd_reg(REG_RAX, 4));
+        }
+        emit1(I_CALL, opd_label(inst->name, -1));
+        result(inst);
+        return;
+    case IR_JMP:
+        jump(bb, bb->succs[0]);
+        return;
+    case IR_BR:
+        isel_branch(bb, args[0]);
+        return;
+    case IR_RET:
+        load_reg(REG_RAX, args[0]);
+        if (bb->next) {
+            emit1(I_JMP, opd_label(return_label, -1));
+        }
+        return;
+    }
+    error("cannot select instructions for IR op %d", inst->op);
+}
+
+// Generates the body of a function, from the prologue to the epilogue.
+void isel(IrFunc *f) {
+    Function *fn = f->fn;
+    block_label = format(".Lbb.%s.", fn->name);
+    edge_label = format(".Ledge.%s.", fn->name);
+    return_label = format(".Lreturn.%s", fn->name);
+    edges = NULL;
+    last_edge = &edges;
+    num_edges = 0;
+
+    count_uses(f);
+    layout(f);
+
+    emit1(I_PUSH, opd_reg(REG_RBP, 8));
+    emit2(I_MOV, opd_reg(REG_RBP, 8), opd_reg(REG_RSP, 8));
+    emit2(I_SUB, opd_reg(REG_RSP, 8), opd_imm(fn->stack_size));
+
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        if (bb->is_loop && opt_align_loops > 1) {
+            emit1(I_ALIGN, opd_imm(opt_align_loops));
+        }
+        emit_label(block_label, bb->id);
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            isel_inst(inst);
+        }
+    }
+
+    emit_label(return_label, -1);
+    emit2(I_MOV, opd_reg(REG_RSP, 8), opd_reg(REG_RBP, 8));
+    emit1(I_POP, opd_reg(REG_RBP, 8));
+    emit0(I_RET);
+
+    for (Edge *e = edges; e; e = e->next) {
+        emit_label(edge_label, e->num);
+        copy_phis(e->from, e->to);
+        emit1(I_JMP, opd_label(block_label, e->to->id));
+    }
+}
@@ -1,51 +1,332 @@
-#include "9cc.h"
-
-char *read_file(char *path) {
-    // open and read the file.
-    FILE *fp = fopen(path, "r");
-    if (!fp) {
-        error("cannot open %s: %s", path, strerror(errno));
-    }
-
-    int filemax = 10*1024*1024;
-    char *buf = malloc(filemax);
-    int size = fread(buf, 1, filemax-2, fp);
-    if (!feof(fp)) {
-        error("%s: file too large");
-    }
-
-    // Make sure that the string ends and with "\n\0".
-    if (size == 0|| buf[size-1] != '\n') {
-        buf[size++] = '\n';
-    }
-    buf[size] = '\0';
-    return buf;
-}
-
-int main(int argc, char **argv) {
-    if (argc != 2) {
-        error("%s: invalid number of arguments", argv[0]);
-    }
-    locals = NULL;
-    // tokenize and parse input
-    filename = argv[1];
-    user_input = read_file(argv[1]);
-    token = tokenize(user_input);
-    Program *prog = program();
-    add_type(prog);
-
-    for (Function *fn = prog->fns; fn; fn = fn->next) {
-        int offset = 0;
-        for (VarList *vl = fn->locals; vl; vl = vl->next) {
-            Var *var = vl->var;
-            offset = align_to(offset, var->ty->align);
-            offset += size_of(var->ty);
-            var->offset = offset;
-        }
-        fn->stack_size = align_to(offset, 8);
-    }
-
-    codegen(prog);
-
-    return 0;
-}
+#include "9cc.h"
+
+// Reads a stream that cannot be mapped, such as a pipe. The buffer
+// always keeps two spare bytes for the terminating "\n\0".
+static char *read_stream(int fd, size_t *size) {
+    size_t cap = 64 * 1024;
+    size_t len = 0;
+    char *buf = malloc(cap);
+
+    for (;;) {
+        if (cap - len < 2) {
+            cap *= 2;
+            buf = realloc(buf, cap);
+        }
+        ssize_t n = read(fd, buf + len, cap - len - 2);
+        if (n == 0) {
+            break;
+        }
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error("cannot read %s: %s", filename, strerror(errno));
+        }
+        len += n;
+    }
+    *size = len;
+    return buf;
+}
+
+// Length of the mapping made by read_file(), or 0 if the input was
+// read into a malloc'ed buffer.
+static size_t input_map_len;
+
+// Returns the contents of a file, or of stdin if the path is "-".
+// Regular files are mapped rather than copied.
+char *read_file(char *path) {
+    int fd = strcmp(path, "-") ? open(path, O_RDONLY) : 0;
+    if (fd < 0) {
+        error("cannot open %s: %s", path, strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        error("cannot stat %s: %s", path, strerror(errno));
+    }
+
+    char *buf;
+    size_t size;
+    if (S_ISREG(st.st_mode) && st.st_size > 0) {
+        // Reserve zero-filled memory for the file plus the sentinel and
+        // map the file over its beginning. Bytes past the end of the file
+        // read as 0, and the private mapping lets us write the sentinel
+        // without touching the file.
+        size = st.st_size;
+        long page = sysconf(_SC_PAGESIZE);
+        size_t len = (size + 2 + page - 1) / page * page;
+        buf = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (buf == MAP_FAILED ||
+            mmap(buf, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            error("cannot map %s: %s", path, strerror(errno));
+        }
+        input_map_len = len;
+    } else {
+        buf = read_stream(fd, &size);
+        input_map_len = 0;
+    }
+    if (fd != 0) {
+        close(fd);
+    }
+
+    // Make sure that the string ends and with "\n\0".
+    if (size == 0|| buf[size-1] != '\n') {
+        buf[size++] = '\n';
+    }
+    buf[size] = '\0';
+    return buf;
+}
+
+// The options start out as set by default_options().
+bool opt_mem_report;
+bool opt_fold;
+int opt_jobs;
+char *opt_cache;
+bool opt_cache_report;
+bool opt_time_report;
+char *opt_trace;
+bool opt_ssa;
+bool opt_dump_ir;
+bool opt_peephole;
+bool opt_peephole_report;
+int opt_align_loops;
+bool opt_omit_frame_pointer;
+int opt_inline_limit;
+bool opt_dce;
+bool opt_dce_report;
+
+// Sets every option to its default. Each compile starts from here, so
+// a job of the compile server does not see the flags of the one before.
+static void default_options(void) {
+    outfile = NULL;
+    emit_obj = false;
+    opt_mem_report = false;
+    opt_fold = true;
+    opt_jobs = 1;
+    opt_cache = NULL;
+    opt_cache_report = false;
+    opt_time_report = false;
+    opt_trace = NULL;
+    opt_ssa = false;
+    opt_dump_ir = false;
+    opt_peephole = true;
+    opt_peephole_report = false;
+    opt_align_loops = 16;
+    opt_omit_frame_pointer = false;
+    opt_inline_limit = 40;
+    opt_dce = true;
+    opt_dce_report = false;
+}
+
+static void usage(char *argv0) {
+    error("usage: %s [-c] [-j <jobs>] [-o <path>] [-fmem-report] [-fno-fold]\n"
+          "       [-fcache=<dir>] [-fcache-report] [-ftime-report] [-ftrace=<file>]\n"
+          "       [-fssa] [-fdump-ir] [-fno-peephole] [-fpeephole-report]\n"
+          "       [-falign-loops=<bytes>] [-fomit-frame-pointer] [-finline-limit=<nodes>]\n"
+          "       [-fno-dce] [-fdce-report] <file>\n"
+          "       %s --server <socket>", argv0, argv0);
+}
+
+static void parse_args(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o")) {
+            if (++i == argc) {
+                usage(argv[0]);
+            }
+            outfile = argv[i];
+            continue;
+        }
+        if (!strncmp(argv[i], "-o", 2)) {
+            outfile = argv[i] + 2;
+            continue;
+        }
+        if (!strncmp(argv[i], "-j", 2)) {
+            char *arg = argv[i] + 2;
+            if (!*arg) {
+                if (++i == argc) {
+                    usage(argv[0]);
+                }
+                arg = argv[i];
+            }
+            char *end;
+            opt_jobs = strtol(arg, &end, 10);
+            if (*end || opt_jobs < 0) {
+                usage(argv[0]);
+            }
+            // -j0 uses every online CPU.
+            if (opt_jobs == 0) {
+                opt_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+            }
+            continue;
+        }
+        if (!strcmp(argv[i], "-c")) {
+            emit_obj = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fmem-report")) {
+            opt_mem_report = true;
+            continue;
+        }
+        if (!strncmp(argv[i], "-fcache=", 8)) {
+            opt_cache = argv[i] + 8;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fcache-report")) {
+            opt_cache_report = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-ftime-report")) {
+            opt_time_report = true;
+            continue;
+        }
+        if (!strncmp(argv[i], "-ftrace=", 8)) {
+            opt_trace = argv[i] + 8;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fno-fold")) {
+            opt_fold = false;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fssa")) {
+            opt_ssa = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fdump-ir")) {
+            opt_dump_ir = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fno-peephole")) {
+            opt_peephole = false;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fpeephole-report")) {
+            opt_peephole_report = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fomit-frame-pointer")) {
+            opt_omit_frame_pointer = true;
+            continue;
+        }
+        if (!strncmp(argv[i], "-falign-loops=", 14)) {
+            // A power of two up to a page; 1 turns alignment off.
+            char *end;
+            opt_align_loops = strtol(argv[i] + 14, &end, 10);
+            if (*end || opt_align_loops < 1 || opt_align_loops > 4096 ||
+                (opt_align_loops & (opt_align_loops - 1))) {
+                usage(argv[0]);
+            }
+            continue;
+        }
+        if (!strcmp(argv[i], "-fno-dce")) {
+            opt_dce = false;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fdce-report")) {
+            opt_dce_report = true;
+            continue;
+        }
+        if (!strncmp(argv[i], "-finline-limit=", 15)) {
+            // The largest callee, in AST nodes; 0 turns inlining off.
+            char *end;
+            opt_inline_limit = strtol(argv[i] + 15, &end, 10);
+            if (*end || opt_inline_limit < 0) {
+                usage(argv[0]);
+            }
+            continue;
+        }
+        if ((argv[i][0] == '-' && argv[i][1]) || filename) {
+            usage(argv[0]);
+        }
+        filename = argv[i];
+    }
+    if (!filename) {
+        usage(argv[0]);
+    }
+}
+
+// Compiles the file named on the command line.
+void compile(int argc, char **argv) {
+    default_options();
+    parse_args(argc, argv);
+    // The cache holds assembly text, which object output cannot use.
+    if (opt_cache && emit_obj) {
+        opt_cache = NULL;
+    }
+    if (opt_cache) {
+        cache_init();
+    }
+    report_init();
+
+    // tokenize and parse input
+    Mark m = mark();
+    user_input = read_file(filename);
+    phase_end(PH_READ, &m);
+
+    m = mark();
+    tokens = tokenize(user_input);
+    phase_end(PH_TOKENIZE, &m);
+
+    m = mark();
+    Program *prog = program();
+    phase_end(PH_PARSE, &m);
+
+    if (opt_inline_limit) {
+        m = mark();
+        inline_functions(prog);
+        phase_end(PH_INLINE, &m);
+    }
+
+    codegen(prog);
+
+    if (opt_mem_report) {
+        arena_report(stderr);
+    }
+    if (opt_cache_report) {
+        cache_report(stderr);
+    }
+    if (opt_peephole_report) {
+        peephole_report(stderr);
+    }
+    if (opt_dce_report) {
+        dce_report(stderr);
+    }
+    if (opt_time_report) {
+        time_report(stderr);
+    }
+    if (opt_trace) {
+        write_trace(opt_trace);
+    }
+}
+
+// Returns every piece of global state to how it is at startup, except
+// for interned names and memory that can be reused, so that the compile
+// server can run the next job. Also called after a failed job. The
+// options are left to default_options().
+void reset_compiler(void) {
+    if (user_input) {
+        if (input_map_len) {
+            munmap(user_input, input_map_len);
+        } else {
+            free(user_input);
+        }
+        user_input = NULL;
+        input_map_len = 0;
+    }
+    filename = NULL;
+
+    reset_parser();
+    reset_emit();
+    reset_peephole();
+    reset_dce();
+    reset_elf();
+    arena_reset();
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && !strcmp(argv[1], "--server")) {
+        run_server(argv[2]);
+        return 0;
+    }
+    compile(argc, argv);
+    return 0;
+}
@@ -0,0 +1,697 @@
+#include "9cc.h"
+
+// Peephole optimizer. The instructions of a function are held back
+// while it is generated, and short windows of them are rewritten into
+// cheaper equivalents before they go to the output. Whether a register
+// is still needed after an instruction comes from a liveness analysis
+// over the whole function, so rules never have to rely on how codegen
+// happens to use its registers.
+
+typedef enum {
+    R_LEA_FOLD,     // lea r, [m]; ... op [r] => op [m]
+    R_STORE_LOAD,   // mov [m], r; mov s, [m] => mov [m], r; mov s, r
+    R_IMM_FOLD,     // mov r, imm; op x, r => op x, imm
+    R_COALESCE,     // mov r, x; mov s, r => mov s, x
+    R_SETCC_JCC,    // setcc al; movzx r, al; cmp r, 0; je l => jncc l
+    R_PUSH_POP,     // push r; pop s => mov s, r
+    R_NOP_ARITH,    // add r, 0 / sub r, 0 / imul r, 1 => nothing
+    R_JMP_NEXT,     // jmp l; l: => l:
+    R_DEAD,         // definition of a register that is never read
+    NUM_RULES,
+} Rule;
+
+static char *rule_names[] = {
+    [R_LEA_FOLD] = "lea-fold",
+    [R_STORE_LOAD] = "store-load",
+    [R_IMM_FOLD] = "imm-fold",
+    [R_COALESCE] = "coalesce",
+    [R_SETCC_JCC] = "setcc-jcc",
+    [R_PUSH_POP] = "push-pop",
+    [R_NOP_ARITH] = "nop-arith",
+    [R_JMP_NEXT] = "jmp-next",
+    [R_DEAD] = "dead",
+};
+
+static long total_hits[NUM_RULES];
+static long insts_before;
+static long insts_after;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Sets of registers, plus the flags, as bit masks. The low byte of a
+// register is tracked apart from the rest, because setcc writes only
+// the low byte and movzx reads only that.
+typedef unsigned long RegSet;
+
+#define FLAGS (1ul << 32)
+#define ALL_REGS (FLAGS | 0xfffffffful)
+
+static RegSet low(Reg reg) {
+    return reg < 16 ? 1ul << reg : 0;
+}
+
+static RegSet bit(Reg reg) {
+    return reg < 16 ? (1ul << reg) | (1ul << (reg + 16)) : 0;
+}
+
+static RegSet arg_regs(void) {
+    return bit(REG_RDI) | bit(REG_RSI) | bit(REG_RDX) | bit(REG_RCX) | bit(REG_R8) | bit(REG_R9);
+}
+
+static RegSet caller_saved(void) {
+    return arg_regs() | bit(REG_RAX) | bit(REG_R10) | bit(REG_R11) | FLAGS;
+}
+
+static RegSet callee_saved(void) {
+    return bit(REG_RBX) | bit(REG_RSP) | bit(REG_RBP) | bit(REG_R12) | bit(REG_R13) |
+           bit(REG_R14) | bit(REG_R15);
+}
+
+static RegSet read_by(Operand *opd) {
+    if (opd->kind == OPD_REG) {
+        return opd->size == 1 ? low(opd->reg) : bit(opd->reg);
+    }
+    if (opd->kind == OPD_MEM) {
+        return bit(opd->reg) | (opd->scale ? bit(opd->index) : 0);
+    }
+    return 0;
+}
+
+static bool is_reg(Operand *opd, Reg reg) {
+    return opd->kind == OPD_REG && opd->reg == reg;
+}
+
+// Adds a write of register operand `opd` to `def`. A 16-bit write
+// keeps the upper bits, so it also reads them.
+static void write_reg(Operand *opd, RegSet *use, RegSet *def) {
+    if (opd->size == 1) {
+        *def |= low(opd->reg);
+    } else {
+        *def |= bit(opd->reg);
+        if (opd->size == 2) {
+            *use |= bit(opd->reg) & ~low(opd->reg);
+        }
+    }
+}
+
+// Registers an instruction reads and writes.
+static void regs_of(Inst *inst, RegSet *use, RegSet *def) {
+    Operand *lhs = &inst->lhs;
+    Operand *rhs = &inst->rhs;
+    *use = *def = 0;
+
+    switch (inst->op) {
+    case I_MOV:
+    case I_MOVSX:
+    case I_MOVSXD:
+    case I_MOVZX:
+    case I_LEA:
+        *use = read_by(rhs);
+        if (lhs->kind == OPD_REG) {
+            write_reg(lhs, use, def);
+        } else {
+            *use |= read_by(lhs);
+        }
+        return;
+    case I_IMUL:
+        if (rhs->kind == OPD_NONE) {
+            *use = bit(REG_RAX) | read_by(lhs);
+            *def = bit(REG_RAX) | bit(REG_RDX) | FLAGS;
+            return;
+        }
+        // fallthrough
+    case I_ADD:
+    case I_SUB:
+    case I_AND:
+    case I_NEG:
+    case I_SHL:
+    case I_SHR:
+    case I_SAR:
+        *use = read_by(lhs) | read_by(rhs);
+        *def = FLAGS;
+        if (lhs->kind == OPD_REG) {
+            write_reg(lhs, use, def);
+        }
+        return;
+    case I_XOR:
+        // xor r, r sets r to zero whatever it held.
+        *use = lhs->kind == OPD_REG && is_reg(rhs, lhs->reg) ? 0 : read_by(lhs) | read_by(rhs);
+        *def = FLAGS;
+        if (lhs->kind == OPD_REG) {
+            write_reg(lhs, use, def);
+        }
+        return;
+    case I_CMP:
+        *use = read_by(lhs) | read_by(rhs);
+        *def = FLAGS;
+        return;
+    case I_CQO:
+        *use = bit(REG_RAX);
+        *def = bit(REG_RDX);
+        return;
+    case I_IDIV:
+        *use = bit(REG_RAX) | bit(REG_RDX) | read_by(lhs);
+        *def = bit(REG_RAX) | bit(REG_RDX) | FLAGS;
+        return;
+    case I_SETCC:
+        *use = FLAGS;
+        write_reg(lhs, use, def);
+        return;
+    case I_JCC:
+        *use = FLAGS;
+        return;
+    case I_CALL:
+        *use = arg_regs() | bit(REG_RAX) | bit(REG_RSP);
+        *def = caller_saved();
+        return;
+    case I_PUSH:
+        *use = bit(lhs->reg) | bit(REG_RSP);
+        *def = bit(REG_RSP);
+        return;
+    case I_POP:
+        *use = bit(REG_RSP);
+        *def = bit(lhs->reg) | bit(REG_RSP);
+        return;
+    case I_RET:
+        *use = bit(REG_RAX) | callee_saved();
+        return;
+    }
+}
+
+// Index of a label by name and number.
+typedef struct {
+    char *name;
+    int num;
+    int idx;
+} LabelEntry;
+
+typedef struct {
+    LabelEntry *entries;
+    int cap;
+} LabelMap;
+
+static unsigned label_hash(char *name, int num) {
+    return hash_str(name, strlen(name)) ^ (num * 2654435761u);
+}
+
+static void label_put(LabelMap *map, char *name, int num, int idx) {
+    unsigned i = label_hash(name, num) & (map->cap - 1);
+    while (map->entries[i].name) {
+        i = (i + 1) & (map->cap - 1);
+    }
+    map->entries[i] = (LabelEntry){name, num, idx};
+}
+
+static int label_get(LabelMap *map, char *name, int num) {
+    unsigned i = label_hash(name, num) & (map->cap - 1);
+    for (; map->entries[i].name; i = (i + 1) & (map->cap - 1)) {
+        LabelEntry *e = &map->entries[i];
+        if (e->num == num && !strcmp(e->name, name)) {
+            return e->idx;
+        }
+    }
+    return -1;
+}
+
+typedef struct {
+    Inst *insts;
+    int len;
+    bool *gone;         // deleted in the current pass
+    RegSet *live;       // live after each instruction
+    int *target;        // jump target index, -1 if unknown
+    long hits[NUM_RULES];
+} Peep;
+
+// Computes the registers live after each instruction by iterating
+// the backward dataflow equations to a fixed point.
+static void liveness(Peep *p) {
+    int n = p->len;
+    RegSet *live_in = calloc(n + 1, sizeof(RegSet));
+    RegSet *use = calloc(n, sizeof(RegSet));
+    RegSet *def = calloc(n, sizeof(RegSet));
+    for (int i = 0; i < n; i++) {
+        regs_of(&p->insts[i], &use[i], &def[i]);
+    }
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int i = n - 1; i >= 0; i--) {
+            Inst *inst = &p->insts[i];
+            RegSet out = 0;
+            if (inst->op == I_JMP || inst->op == I_JCC) {
+                out = p->target[i] < 0 ? ALL_REGS : live_in[p->target[i]];
+            }
+            if (inst->op != I_JMP && inst->op != I_RET) {
+                out |= live_in[i + 1];
+            }
+            RegSet in = use[i] | (out & ~def[i]);
+            if (out != p->live[i] || in != live_in[i]) {
+                p->live[i] = out;
+                live_in[i] = in;
+                changed = true;
+            }
+        }
+    }
+    free(live_in);
+    free(use);
+    free(def);
+}
+
+static void find_targets(Peep *p) {
+    LabelMap map = {0};
+    int num_labels = 0;
+    for (int i = 0; i < p->len; i++) {
+        num_labels += p->insts[i].op == I_LABEL;
+    }
+    map.cap = 16;
+    while (map.cap < num_labels * 2) {
+        map.cap *= 2;
+    }
+    map.entries = calloc(map.cap, sizeof(LabelEntry));
+    for (int i = 0; i < p->len; i++) {
+        Inst *inst = &p->insts[i];
+        if (inst->op == I_LABEL) {
+            label_put(&map, inst->lhs.name, inst->lhs.num, i);
+        }
+    }
+    for (int i = 0; i < p->len; i++) {
+        Inst *inst = &p->insts[i];
+        p->target[i] = -1;
+        if (inst->op == I_JMP || inst->op == I_JCC) {
+            p->target[i] = label_get(&map, inst->lhs.name, inst->lhs.num);
+        }
+    }
+    free(map.entries);
+}
+
+// Returns the next instruction after `i` that has not been deleted.
+static int next(Peep *p, int i) {
+    do {
+        i++;
+    } while (i < p->len && p->gone[i]);
+    return i;
+}
+
+static bool dead_after(Peep *p, int i, RegSet regs) {
+    return !(p->live[i] & regs);
+}
+
+static bool is_def(Inst *inst) {
+    switch (inst->op) {
+    case I_MOV:
+    case I_MOVSX:
+    case I_MOVSXD:
+    case I_MOVZX:
+    case I_LEA:
+        return inst->lhs.kind == OPD_REG && inst->lhs.size >= 4;
+    }
+    return false;
+}
+
+static bool is_barrier(Inst *inst) {
+    switch (inst->op) {
+    case I_LABEL:
+    case I_JMP:
+    case I_JCC:
+    case I_CALL:
+    case I_RET:
+    case I_PUSH:
+    case I_POP:
+        return true;
+    }
+    return false;
+}
+
+static bool fits_imm(long val) {
+    return val == (int)val;
+}
+
+// lea r, [m] followed, possibly after instructions that leave r alone,
+// by a memory access through r that is r's last use. An add of a
+// constant to r right after the lea goes into its displacement.
+static bool lea_fold(Peep *p, int i) {
+    Inst *lea = &p->insts[i];
+    if (lea->op != I_LEA || lea->lhs.kind != OPD_REG || lea->rhs.scale ||
+        (lea->rhs.reg != REG_RBP && lea->rhs.reg != REG_RSP && lea->rhs.reg != REG_RIP)) {
+        return false;
+    }
+    Reg r = lea->lhs.reg;
+
+    int k = next(p, i);
+    if (k < p->len) {
+        Inst *add = &p->insts[k];
+        if ((add->op == I_ADD || add->op == I_SUB) && is_reg(&add->lhs, r) &&
+            add->lhs.size == 8 && add->rhs.kind == OPD_IMM && dead_after(p, k, FLAGS)) {
+            long disp = lea->rhs.val + (add->op == I_ADD ? add->rhs.val : -add->rhs.val);
+            if (fits_imm(disp)) {
+                lea->rhs.val = disp;
+                p->gone[k] = true;
+                return true;
+            }
+        }
+    }
+
+    int j = i;
+    for (int steps = 0; steps < 4; steps++) {
+        j = next(p, j);
+        if (j == p->len || is_barrier(&p->insts[j])) {
+            return false;
+        }
+        Inst *inst = &p->insts[j];
+        RegSet use, def;
+        regs_of(inst, &use, &def);
+        if (def & bit(lea->rhs.reg)) {
+            return false;
+        }
+        if (!((use | def) & bit(r))) {
+            continue;
+        }
+
+        Operand *mem = &inst->lhs;
+        Operand *other = &inst->rhs;
+        if (!(mem->kind == OPD_MEM && mem->reg == r)) {
+            mem = &inst->rhs;
+            other = &inst->lhs;
+        }
+        if (mem->kind != OPD_MEM || mem->reg != r ||
+            (mem->scale && (mem->index == r || lea->rhs.reg == REG_RIP))) {
+            return false;
+        }
+        // r may be overwritten by the access, but not read by it otherwise.
+        bool redefined = is_def(inst) && other == &inst->lhs && is_reg(other, r);
+        if (!redefined && (read_by(other) & bit(r) || !dead_after(p, j, bit(r)))) {
+            return false;
+        }
+        mem->reg = lea->rhs.reg;
+        mem->name = lea->rhs.name;
+        mem->val += lea->rhs.val;
+        p->gone[i] = true;
+        return true;
+    }
+    return false;
+}
+
+static bool same_mem(Operand *a, Operand *b) {
+    return a->kind == OPD_MEM && b->kind == OPD_MEM && a->reg == b->reg && a->val == b->val &&
+           a->size == b->size && a->name == b->name && a->scale == b->scale &&
+           (!a->scale || a->index == b->index);
+}
+
+// A load right after a store to the same frame or global slot reads
+// the stored register instead.
+static bool store_load(Peep *p, int i) {
+    Inst *st = &p->insts[i];
+    if (st->op != I_MOV || st->lhs.kind != OPD_MEM || st->rhs.kind != OPD_REG ||
+        (st->lhs.reg != REG_RBP && st->lhs.reg != REG_RSP && st->lhs.reg != REG_RIP)) {
+        return false;
+    }
+    int j = next(p, i);
+    if (j == p->len) {
+        return false;
+    }
+    Inst *ld = &p->insts[j];
+    int size = st->lhs.size;
+    if (ld->lhs.kind != OPD_REG || !same_mem(&ld->rhs, &st->lhs)) {
+        return false;
+    }
+    bool ok = (ld->op == I_MOV && size == 8) || (ld->op == I_MOVSXD && size == 4) ||
+              (ld->op == I_MOVSX && size < 4);
+    if (!ok) {
+        return false;
+    }
+    ld->rhs = opd_reg(st->rhs.reg, size);
+    if (ld->op == I_MOV && ld->lhs.reg == st->rhs.reg) {
+        p->gone[j] = true;
+    }
+    return true;
+}
+
+// mov r, imm followed by the last use of r as a source operand.
+static bool imm_fold(Peep *p, int i) {
+    Inst *mov = &p->insts[i];
+    if (mov->op != I_MOV || mov->lhs.kind != OPD_REG || mov->lhs.size != 8 ||
+        mov->rhs.kind != OPD_IMM || !fits_imm(mov->rhs.val)) {
+        return false;
+    }
+    Reg r = mov->lhs.reg;
+    int j = next(p, i);
+    if (j == p->len || !dead_after(p, j, bit(r))) {
+        return false;
+    }
+    Inst *inst = &p->insts[j];
+    if (!is_reg(&inst->rhs, r) || read_by(&inst->lhs) & bit(r)) {
+        return false;
+    }
+
+    long val = mov->rhs.val;
+    switch (inst->op) {
+    case I_ADD:
+    case I_SUB:
+    case I_AND:
+    case I_XOR:
+    case I_CMP:
+        break;
+    case I_IMUL:
+        if (inst->lhs.kind != OPD_REG) {
+            return false;
+        }
+        break;
+    case I_MOV:
+        // A store of the low bytes of r.
+        if (inst->lhs.kind != OPD_MEM) {
+            return false;
+        }
+        if (inst->rhs.size == 1) {
+            val = (signed char)val;
+        } else if (inst->rhs.size == 2) {
+            val = (short)val;
+        } else if (inst->rhs.size == 4) {
+            val = (int)val;
+        }
+        break;
+    default:
+        return false;
+    }
+    inst->rhs = opd_imm(val);
+    p->gone[i] = true;
+    return true;
+}
+
+// An instruction that computes r, followed by a copy of r that is its
+// last use, computes the copy's destination directly.
+static bool coalesce(Peep *p, int i) {
+    Inst *def = &p->insts[i];
+    if (!is_def(def) || def->lhs.size != 8) {
+        return false;
+    }
+    Reg r = def->lhs.reg;
+    int j = next(p, i);
+    if (j == p->len) {
+        return false;
+    }
+    Inst *mov = &p->insts[j];
+    if (mov->op != I_MOV || mov->lhs.kind != OPD_REG || mov->lhs.size != 8 ||
+        !is_reg(&mov->rhs, r) || mov->rhs.size != 8 || mov->lhs.reg == r ||
+        !dead_after(p, j, bit(r))) {
+        return false;
+    }
+    def->lhs.reg = mov->lhs.reg;
+    p->gone[j] = true;
+    return true;
+}
+
+// A boolean that is materialized only to be tested by the next jump.
+static bool setcc_jcc(Peep *p, int i) {
+    Inst *set = &p->insts[i];
+    if (set->op != I_SETCC) {
+        return false;
+    }
+    int j = next(p, i);
+    int k = j < p->len ? next(p, j) : p->len;
+    int l = k < p->len ? next(p, k) : p->len;
+    if (l == p->len) {
+        return false;
+    }
+    Inst *zx = &p->insts[j];
+    Inst *cmp = &p->insts[k];
+    Inst *jcc = &p->insts[l];
+    if (zx->op != I_MOVZX || zx->lhs.kind != OPD_REG || !is_reg(&zx->rhs, set->lhs.reg) ||
+        cmp->op != I_CMP || !is_reg(&cmp->lhs, zx->lhs.reg) || cmp->rhs.kind != OPD_IMM ||
+        cmp->rhs.val != 0 || jcc->op != I_JCC || (jcc->cc != CC_E && jcc->cc != CC_NE) ||
+        !dead_after(p, l, bit(zx->lhs.reg) | low(set->lhs.reg))) {
+        return false;
+    }
+    jcc->cc = jcc->cc == CC_E ? set->cc ^ 1 : set->cc;
+    p->gone[i] = p->gone[j] = p->gone[k] = true;
+    return true;
+}
+
+static bool push_pop(Peep *p, int i) {
+    Inst *push = &p->insts[i];
+    int j = next(p, i);
+    if (push->op != I_PUSH || j == p->len || p->insts[j].op != I_POP) {
+        return false;
+    }
+    Reg src = push->lhs.reg;
+    Reg dst = p->insts[j].lhs.reg;
+    if (src == dst) {
+        p->gone[j] = true;
+    } else {
+        p->insts[j] = (Inst){I_MOV};
+        p->insts[j].lhs = opd_reg(dst, 8);
+        p->insts[j].rhs = opd_reg(src, 8);
+    }
+    p->gone[i] = true;
+    return true;
+}
+
+static bool nop_arith(Peep *p, int i) {
+    Inst *inst = &p->insts[i];
+    if (inst->op == I_MOV && inst->lhs.kind == OPD_REG && inst->lhs.size == 8 &&
+        is_reg(&inst->rhs, inst->lhs.reg) && inst->rhs.size == 8) {
+        p->gone[i] = true;
+        return true;
+    }
+    if (inst->lhs.kind != OPD_REG || inst->rhs.kind != OPD_IMM || !dead_after(p, i, FLAGS)) {
+        return false;
+    }
+    bool nop = ((inst->op == I_ADD || inst->op == I_SUB) && inst->rhs.val == 0) ||
+               (inst->op == I_IMUL && inst->rhs.val == 1);
+    if (nop) {
+        p->gone[i] = true;
+    }
+    return nop;
+}
+
+static bool jmp_next(Peep *p, int i) {
+    Inst *jmp = &p->insts[i];
+    if (jmp->op != I_JMP) {
+        return false;
+    }
+    for (int j = next(p, i); j < p->len && p->insts[j].op == I_LABEL; j = next(p, j)) {
+        if (j == p->target[i]) {
+            p->gone[i] = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Definitions of registers, and of flags, that nothing reads.
+static bool dead(Peep *p, int i) {
+    Inst *inst = &p->insts[i];
+    RegSet use, def;
+    regs_of(inst, &use, &def);
+    switch (inst->op) {
+    case I_MOV:
+    case I_MOVSX:
+    case I_MOVSXD:
+    case I_MOVZX:
+    case I_LEA:
+    case I_ADD:
+    case I_SUB:
+    case I_AND:
+    case I_XOR:
+    case I_NEG:
+    case I_SHL:
+    case I_SHR:
+    case I_SAR:
+    case I_IMUL:
+    case I_CMP:
+    case I_CQO:
+    case I_SETCC:
+        break;
+    default:
+        return false;
+    }
+    // The stack and frame pointers are never dead: memory below them
+    // must stay allocated.
+    if (inst->lhs.kind == OPD_MEM || !def || def & (bit(REG_RSP) | bit(REG_RBP)) ||
+        !dead_after(p, i, def)) {
+        return false;
+    }
+    p->gone[i] = true;
+    return true;
+}
+
+static bool (*rules[])(Peep *, int) = {
+    [R_LEA_FOLD] = lea_fold,
+    [R_STORE_LOAD] = store_load,
+    [R_IMM_FOLD] = imm_fold,
+    [R_COALESCE] = coalesce,
+    [R_SETCC_JCC] = setcc_jcc,
+    [R_PUSH_POP] = push_pop,
+    [R_NOP_ARITH] = nop_arith,
+    [R_JMP_NEXT] = jmp_next,
+    [R_DEAD] = dead,
+};
+
+// Applies the rules in one forward pass and drops the instructions
+// they deleted. Liveness is computed before the pass; rewrites only
+// remove uses or move them next to existing ones, so it stays
+// conservative while the pass runs.
+static bool run_pass(Peep *p) {
+    find_targets(p);
+    liveness(p);
+    memset(p->gone, 0, p->len);
+
+    bool changed = false;
+    for (int i = 0; i < p->len; i++) {
+        if (p->gone[i]) {
+            continue;
+        }
+        for (int r = 0; r < NUM_RULES; r++) {
+            if (rules[r](p, i)) {
+                p->hits[r]++;
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    int n = 0;
+    for (int i = 0; i < p->len; i++) {
+        if (!p->gone[i]) {
+            p->insts[n++] = p->insts[i];
+        }
+    }
+    p->len = n;
+    return changed;
+}
+
+void peephole(InstList *list) {
+    Peep p = {0};
+    p.insts = list->insts;
+    p.len = list->len;
+    p.gone = calloc(p.len + 1, sizeof(bool));
+    p.live = calloc(p.len + 1, sizeof(RegSet));
+    p.target = calloc(p.len + 1, sizeof(int));
+
+    while (run_pass(&p)) {
+    }
+
+    pthread_mutex_lock(&lock);
+    for (int r = 0; r < NUM_RULES; r++) {
+        total_hits[r] += p.hits[r];
+    }
+    insts_before += list->len;
+    insts_after += p.len;
+    pthread_mutex_unlock(&lock);
+
+    list->len = p.len;
+    free(p.gone);
+    free(p.live);
+    free(p.target);
+}
+
+void peephole_report(FILE *fp) {
+    fprintf(fp, "%-12s %10s\n", "rule", "hits");
+    for (int r = 0; r < NUM_RULES; r++) {
+        fprintf(fp, "%-12s %10ld\n", rule_names[r], total_hits[r]);
+    }
+    fprintf(fp, "instructions: %ld before, %ld after\n", insts_before, insts_after);
+}
+
+void reset_peephole(void) {
+    memset(total_hits, 0, sizeof(total_hits));
+    insts_before = insts_after = 0;
+}
@@ -0,0 +1,136 @@
+#include "9cc.h"
+
+// Strength reduction of multiplication and signed division by
+// constants, shared by both backends. Each helper rewrites a register
+// in place; a multiplication may clobber rdx, and a division clobbers
+// rax and rdx, so neither may be used on those.
+
+static int log2_of(unsigned long val) {
+    int k = 0;
+    while (val >>= 1) {
+        k++;
+    }
+    return k;
+}
+
+static bool is_pow2(unsigned long val) {
+    return val && !(val & (val - 1));
+}
+
+static Operand r64(Reg reg) {
+    return opd_reg(reg, 8);
+}
+
+// Emits rd *= c for c > 1 with shifts and lea if it can be done in two
+// instructions, and returns whether it could.
+static bool mul_shift(Reg rd, unsigned long c) {
+    int k = 0;
+    while (!(c & 1)) {
+        c >>= 1;
+        k++;
+    }
+    if (c != 1 && c != 3 && c != 5 && c != 9) {
+        return false;
+    }
+    if (c != 1) {
+        emit2(I_LEA, r64(rd), opd_index(rd, rd, c - 1, 0));
+    }
+    if (k) {
+        emit2(I_SHL, r64(rd), opd_imm(k));
+    }
+    return true;
+}
+
+// Emits rd = rd * c.
+void mul_imm(Reg rd, long c) {
+    assert(rd != REG_RAX && rd != REG_RDX);
+    if (c == 1) {
+        return;
+    }
+    if (c == 0) {
+        emit2(I_XOR, opd_reg(rd, 4), opd_reg(rd, 4));
+        return;
+    }
+    if (c > 0 && mul_shift(rd, c)) {
+        return;
+    }
+    if (c < 0 && (c == -1 || mul_shift(rd, -(unsigned long)c))) {
+        emit1(I_NEG, r64(rd));
+        return;
+    }
+    if (c == (int)c) {
+        emit2(I_IMUL, r64(rd), opd_imm(c));
+        return;
+    }
+    emit2(I_MOV, r64(REG_RDX), opd_imm(c));
+    emit2(I_IMUL, r64(rd), r64(REG_RDX));
+}
+
+// Computes the multiplier and shift that divide by d >= 3, not a power
+// of two, with a high multiply. See Hacker's Delight, section 10-4.
+static void magic(unsigned long d, long *mul, int *shift) {
+    unsigned long two63 = 1ul << 63;
+    unsigned long anc = two63 - 1 - two63 % d;
+    unsigned long q1 = two63 / anc;
+    unsigned long r1 = two63 - q1 * anc;
+    unsigned long q2 = two63 / d;
+    unsigned long r2 = two63 - q2 * d;
+    unsigned long delta;
+    int p = 63;
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= d) {
+            q2++;
+            r2 -= d;
+        }
+        delta = d - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+    *mul = q2 + 1;
+    *shift = p - 64;
+}
+
+// Emits rd = rd / c, rounding toward zero like idiv, for c != 0.
+void div_imm(Reg rd, long c) {
+    assert(rd != REG_RAX && rd != REG_RDX && c);
+    unsigned long d = c < 0 ? -(unsigned long)c : c;
+    Operand q = r64(rd);
+
+    if (is_pow2(d) && d > 1) {
+        // Negative dividends are biased by d-1 so that the arithmetic
+        // shift rounds toward zero.
+        int k = log2_of(d);
+        emit2(I_MOV, r64(REG_RAX), q);
+        if (k > 1) {
+            emit2(I_SAR, r64(REG_RAX), opd_imm(63));
+        }
+        emit2(I_SHR, r64(REG_RAX), opd_imm(64 - k));
+        emit2(I_ADD, q, r64(REG_RAX));
+        emit2(I_SAR, q, opd_imm(k));
+    } else if (d > 1) {
+        // The high half of rd * mul, plus one if rd is negative.
+        long mul;
+        int shift;
+        magic(d, &mul, &shift);
+        emit2(I_MOV, r64(REG_RAX), opd_imm(mul));
+        emit1(I_IMUL, q);
+        if (mul < 0) {
+            emit2(I_ADD, r64(REG_RDX), q);
+        }
+        if (shift) {
+            emit2(I_SAR, r64(REG_RDX), opd_imm(shift));
+        }
+        emit2(I_SHR, q, opd_imm(63));
+        emit2(I_ADD, q, r64(REG_RDX));
+    }
+    if (c < 0) {
+        emit1(I_NEG, q);
+    }
+}
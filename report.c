@@ -0,0 +1,239 @@
+#include "9cc.h"
+#include <sys/resource.h>
+#include <time.h>
+
+// Compile-time instrumentation for -ftime-report and -ftrace. Each
+// phase is timed with a monotonic clock and charged with the nodes,
+// types and instructions created and the output bytes emitted while it
+// ran. The backend phases run
+// once per function, possibly on several threads; their totals are
+// summed over all functions. Every top-level phase and every function
+// also becomes a trace event.
+
+bool timing;
+
+_Thread_local Counters counters;
+
+static char *phase_names[NUM_PHASES] = {
+    [PH_READ] = "read",
+    [PH_TOKENIZE] = "tokenize",
+    [PH_PARSE] = "parse",
+    [PH_INLINE] = "inline",
+    [PH_TYPE] = "type",
+    [PH_FOLD] = "fold",
+    [PH_DCE] = "dce",
+    [PH_LAYOUT] = "layout",
+    [PH_IR] = "ir",
+    [PH_GEN] = "codegen",
+    [PH_PEEPHOLE] = "peephole",
+    [PH_WRITE] = "write",
+};
+
+typedef struct {
+    long ns;
+    long calls;
+    Counters counters;
+    long peak_rss;      // KiB, when the phase last ended
+} PhaseStat;
+
+typedef struct {
+    char *name;
+    char *cat;
+    int tid;
+    long tokens;
+    long start;
+    long ns;
+    Counters counters;
+} Event;
+
+static PhaseStat stats[NUM_PHASES];
+static long start_time;
+static long num_tokens;
+static long output_bytes;
+
+static Event *events;
+static int num_events;
+static int cap_events;
+
+// Protects stats and events, which workers update too.
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int next_tid = 1;
+static _Thread_local int tid;
+
+static long now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+// Peak resident set size of the process in KiB.
+long peak_rss(void) {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+void report_init(void) {
+    timing = opt_time_report || opt_trace;
+    memset(stats, 0, sizeof(stats));
+    num_events = 0;
+    num_tokens = 0;
+    output_bytes = 0;
+    start_time = now();
+}
+
+Mark mark(void) {
+    Mark m = {0};
+    if (timing) {
+        m.time = now();
+        m.counters = counters;
+    }
+    return m;
+}
+
+static Counters since(Mark *m) {
+    Counters c;
+    c.nodes = counters.nodes - m->counters.nodes;
+    c.types = counters.types - m->counters.types;
+    c.insts = counters.insts - m->counters.insts;
+    c.bytes = counters.bytes - m->counters.bytes;
+    return c;
+}
+
+// Called with `lock` held.
+static void add_event(char *name, char *cat, Mark *m, long ns, Counters c) {
+    if (!tid) {
+        tid = next_tid++;
+    }
+    if (num_events == cap_events) {
+        cap_events = cap_events ? cap_events * 2 : 256;
+        events = realloc(events, sizeof(Event) * cap_events);
+    }
+    Event *ev = &events[num_events++];
+    ev->name = name;
+    ev->cat = cat;
+    ev->tid = tid;
+    ev->start = m->time - start_time;
+    ev->ns = ns;
+    ev->tokens = 0;
+    ev->counters = c;
+}
+
+// Charges the time and counters since `m` to phase `ph`.
+void phase_end(Phase ph, Mark *m) {
+    if (!timing) {
+        return;
+    }
+    long ns = now() - m->time;
+    Counters c = since(m);
+
+    pthread_mutex_lock(&lock);
+    PhaseStat *st = &stats[ph];
+    st->ns += ns;
+    st->calls++;
+    st->counters.nodes += c.nodes;
+    st->counters.types += c.types;
+    st->counters.insts += c.insts;
+    st->counters.bytes += c.bytes;
+    st->peak_rss = peak_rss();
+    if (ph < PH_TYPE || ph > PH_PEEPHOLE) {
+        add_event(phase_names[ph], "phase", m, ns, c);
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+// Records the backend work on one function as a trace event. Tokens
+// and nodes are those of the function, counted when it was parsed.
+void function_end(Function *fn, Mark *m) {
+    if (!timing) {
+        return;
+    }
+    long ns = now() - m->time;
+    Counters c = since(m);
+    c.nodes = fn->num_nodes;
+
+    pthread_mutex_lock(&lock);
+    add_event(fn->name, "function", m, ns, c);
+    events[num_events - 1].tokens = fn->num_tokens;
+    pthread_mutex_unlock(&lock);
+}
+
+void report_tokens(long n) {
+    num_tokens = n;
+}
+
+// Records the size of the output file, which also counts cache hits
+// and the ELF headers.
+void report_output(long n) {
+    output_bytes = n;
+}
+
+static int by_time(const void *a, const void *b) {
+    const Event *x = a;
+    const Event *y = b;
+    return (x->ns < y->ns) - (x->ns > y->ns);
+}
+
+#define NUM_SLOWEST 10
+
+void time_report(FILE *fp) {
+    long total = now() - start_time;
+
+    fprintf(fp, "%-10s %10s %6s %8s %10s %10s %10s %10s %12s\n",
+            "phase", "ms", "%", "calls", "nodes", "types", "insts", "bytes", "peak RSS KiB");
+    for (int i = 0; i < NUM_PHASES; i++) {
+        PhaseStat *st = &stats[i];
+        if (!st->calls) {
+            continue;
+        }
+        fprintf(fp, "%-10s %10.3f %6.1f %8ld %10ld %10ld %10ld %10ld %12ld\n",
+                phase_names[i], st->ns / 1e6, total ? 100.0 * st->ns / total : 0.0, st->calls,
+                st->counters.nodes, st->counters.types, st->counters.insts, st->counters.bytes,
+                st->peak_rss);
+    }
+    fprintf(fp, "%-10s %10.3f   (%ld tokens, %ld bytes of output)\n", "total", total / 1e6,
+            num_tokens, output_bytes);
+
+    // The slowest functions, most expensive first.
+    Event *fns = malloc(sizeof(Event) * (num_events + 1));
+    int n = 0;
+    for (int i = 0; i < num_events; i++) {
+        if (!strcmp(events[i].cat, "function")) {
+            fns[n++] = events[i];
+        }
+    }
+    qsort(fns, n, sizeof(Event), by_time);
+    if (n) {
+        fprintf(fp, "\n%-32s %10s %10s %10s %10s %10s %10s\n", "function", "ms", "tokens",
+                "nodes", "types", "insts", "bytes");
+    }
+    for (int i = 0; i < n && i < NUM_SLOWEST; i++) {
+        fprintf(fp, "%-32s %10.3f %10ld %10ld %10ld %10ld %10ld\n", fns[i].name, fns[i].ns / 1e6,
+                fns[i].tokens, fns[i].counters.nodes, fns[i].counters.types,
+                fns[i].counters.insts, fns[i].counters.bytes);
+    }
+    free(fns);
+}
+
+// Writes the events in the Chrome trace event format, which
+// chrome://tracing and Perfetto load directly.
+void write_trace(char *path) {
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        error("cannot open %s: %s", path, strerror(errno));
+    }
+    fprintf(fp, "{\"traceEvents\":[\n");
+    for (int i = 0; i < num_events; i++) {
+        Event *ev = &events[i];
+        fprintf(fp, "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"tokens\":%ld,\"nodes\":%ld,\"types\":%ld,"
+                "\"insts\":%ld,\"bytes\":%ld}},\n",
+                ev->name, ev->cat, ev->tid, ev->start / 1e3, ev->ns / 1e3, ev->tokens,
+                ev->counters.nodes, ev->counters.types, ev->counters.insts, ev->counters.bytes);
+    }
+    fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"9cc\"}}\n");
+    fprintf(fp, "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"tokens\":%ld,\"bytes\":%ld,"
+            "\"peak_rss_kib\":%ld}}\n", num_tokens, output_bytes, peak_rss());
+    fclose(fp);
+}
@@ -0,0 +1,155 @@
+#include "9cc.h"
+#include <signal.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// Compile server. `9cc --server <socket>` accepts jobs from 9cc-client
+// on a Unix domain socket and runs them one after another in this
+// process, so the interned names, arena blocks and token array of one
+// compile are still warm for the next.
+//
+// A request is a 32-bit length followed by that many bytes: the
+// client's working directory and then its arguments, each terminated
+// by '\0'. The client's stdin, stdout and stderr come along as
+// SCM_RIGHTS and stand in for ours while the job runs. The reply is
+// the 32-bit exit status of the job.
+
+#define MAX_REQUEST (1 << 20)
+
+static bool read_full(int fd, char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = read(fd, buf, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Receives a request and its three file descriptors. Returns NULL if the
+// client sent something else.
+static char *recv_request(int conn, int *len, int fds[3]) {
+    uint32_t size;
+    struct iovec iov = {&size, sizeof(size)};
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(sizeof(int) * 3)];
+    } ctl;
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = ctl.buf;
+    msg.msg_controllen = sizeof(ctl.buf);
+
+    ssize_t n = recvmsg(conn, &msg, MSG_WAITALL);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    if (n != sizeof(size) || !cmsg || cmsg->cmsg_type != SCM_RIGHTS ||
+        cmsg->cmsg_len != CMSG_LEN(sizeof(int) * 3)) {
+        return NULL;
+    }
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * 3);
+
+    if (size == 0 || size > MAX_REQUEST) {
+        goto fail;
+    }
+    char *buf = malloc(size);
+    if (!read_full(conn, buf, size) || buf[size - 1] != '\0') {
+        free(buf);
+        goto fail;
+    }
+    *len = size;
+    return buf;
+
+fail:
+    for (int i = 0; i < 3; i++) {
+        close(fds[i]);
+    }
+    return NULL;
+}
+
+// Runs one job with the client's file descriptors in place of ours and
+// returns its exit status.
+static int run_job(char *req, int len, int fds[3]) {
+    // argc and argv are live across the setjmp below.
+    char *cwd = req;
+    char **volatile argv = calloc(len + 2, sizeof(char *));
+    volatile int argc = 0;
+    argv[argc++] = "9cc";
+    for (char *p = cwd + strlen(cwd) + 1; p < req + len; p += strlen(p) + 1) {
+        argv[argc++] = p;
+    }
+
+    int saved[3];
+    for (int i = 0; i < 3; i++) {
+        saved[i] = dup(i);
+        dup2(fds[i], i);
+        close(fds[i]);
+    }
+
+    int status = 0;
+    jmp_buf jb;
+    if (setjmp(jb) == 0) {
+        error_jmp = &jb;
+        if (chdir(cwd) < 0) {
+            error("cannot change directory to %s: %s", cwd, strerror(errno));
+        }
+        compile(argc, argv);
+    } else {
+        status = 1;
+    }
+    error_jmp = NULL;
+    reset_compiler();
+
+    for (int i = 0; i < 3; i++) {
+        dup2(saved[i], i);
+        close(saved[i]);
+    }
+    free(argv);
+    return status;
+}
+
+void run_server(char *path) {
+    struct sockaddr_un addr = {AF_UNIX};
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        error("socket path too long: %s", path);
+    }
+    strcpy(addr.sun_path, path);
+
+    // A client that goes away must not take the server down with it.
+    signal(SIGPIPE, SIG_IGN);
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0) {
+        error("cannot create socket: %s", strerror(errno));
+    }
+    unlink(path);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(sock, 64) < 0) {
+        error("cannot listen on %s: %s", path, strerror(errno));
+    }
+
+    for (;;) {
+        int conn = accept(sock, NULL, NULL);
+        if (conn < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error("accept failed: %s", strerror(errno));
+        }
+
+        int len;
+        int fds[3];
+        char *req = recv_request(conn, &len, fds);
+        if (req) {
+            uint32_t status = run_job(req, len, fds);
+            write(conn, &status, sizeof(status));
+            free(req);
+        }
+        close(conn);
+    }
+}
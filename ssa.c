@@ -0,0 +1,429 @@
+#include "9cc.h"
+
+// Dominators and construction of SSA form. mem2reg() promotes local
+// variables that live in an IR_ALLOCA to SSA values following Cytron et
+// al., "Efficiently Computing Static Single Assignment Form and the
+// Control Dependence Graph": phis go to the iterated dominance frontier
+// of the blocks that store to a variable, and a walk over the
+// dominator tree then replaces every load by the value last stored.
+
+// Returns the blocks reachable from the entry in reverse postorder.
+// `rpo` receives the position of each block in it, or -1.
+static int reverse_postorder(IrFunc *f, Block **order, int *rpo) {
+    int n = f->num_blocks;
+    Block **stack = calloc(n, sizeof(Block *));
+    int *next_succ = calloc(n, sizeof(int));
+    for (int i = 0; i < n; i++) {
+        rpo[i] = -1;
+    }
+
+    // rpo[] marks blocks on the stack or done while the walk runs.
+    int num = n;
+    int sp = 0;
+    stack[sp++] = f->blocks;
+    rpo[f->blocks->id] = 0;
+    while (sp > 0) {
+        Block *bb = stack[sp - 1];
+        if (next_succ[bb->id] < bb->num_succs) {
+            Block *succ = bb->succs[next_succ[bb->id]++];
+            if (rpo[succ->id] < 0) {
+                rpo[succ->id] = 0;
+                stack[sp++] = succ;
+            }
+            continue;
+        }
+        order[--num] = bb;
+        sp--;
+    }
+
+    // Move the reachable blocks to the front.
+    int len = n - num;
+    memmove(order, order + num, len * sizeof(Block *));
+    for (int i = 0; i < len; i++) {
+        rpo[order[i]->id] = i;
+    }
+    free(stack);
+    free(next_succ);
+    return len;
+}
+
+static Block *intersect(Block *a, Block *b, int *rpo) {
+    while (a != b) {
+        while (rpo[a->id] > rpo[b->id]) {
+            a = a->idom;
+        }
+        while (rpo[b->id] > rpo[a->id]) {
+            b = b->idom;
+        }
+    }
+    return a;
+}
+
+// Computes the immediate dominator and the dominator tree depth of every
+// block with the algorithm of Cooper, Harvey and Kennedy, "A Simple,
+// Fast Dominance Algorithm". Unreachable blocks get no idom.
+void compute_dominators(IrFunc *f) {
+    int n = f->num_blocks;
+    Block **order = calloc(n, sizeof(Block *));
+    int *rpo = calloc(n, sizeof(int));
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        bb->idom = NULL;
+    }
+    int len = reverse_postorder(f, order, rpo);
+
+    // The entry is its own idom while the algorithm runs.
+    Block *entry = f->blocks;
+    entry->idom = entry;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int i = 1; i < len; i++) {
+            Block *bb = order[i];
+            Block *idom = NULL;
+            for (int j = 0; j < bb->num_preds; j++) {
+                Block *pred = bb->preds[j];
+                if (!pred->idom) {
+                    continue;
+                }
+                idom = idom ? intersect(pred, idom, rpo) : pred;
+            }
+            if (bb->idom != idom) {
+                bb->idom = idom;
+                changed = true;
+            }
+        }
+    }
+    entry->idom = NULL;
+
+    entry->depth = 0;
+    for (int i = 1; i < len; i++) {
+        order[i]->depth = order[i]->idom->depth + 1;
+    }
+    free(order);
+    free(rpo);
+}
+
+bool dominates(Block *a, Block *b) {
+    while (b->depth > a->depth) {
+        b = b->idom;
+    }
+    return a == b;
+}
+
+typedef struct {
+    Block **blocks;
+    int len;
+} BlockList;
+
+// Appends `bb` unless it was the last block added. The lists below are
+// built so that this is enough to keep out duplicates.
+static void add_block(BlockList *list, Block *bb) {
+    if (list->len && list->blocks[list->len - 1] == bb) {
+        return;
+    }
+    list->blocks = ir_grow(list->blocks, list->len, sizeof(Block *));
+    list->blocks[list->len++] = bb;
+}
+
+typedef struct {
+    IrFunc *f;
+    int *var_of;        // by id of an alloca: its variable number, or -1
+    int num_ids;
+    int num_vars;
+    int first_phi;      // id of the first phi inserted by us
+    BlockList *children;
+    IrInst *zero;       // value of a variable read before it is written
+} Promotion;
+
+static int var_of(Promotion *p, IrInst *addr) {
+    if (addr->op != IR_ALLOCA || addr->id >= p->num_ids) {
+        return -1;
+    }
+    return p->var_of[addr->id];
+}
+
+static IrInst *zero(Promotion *p) {
+    if (!p->zero) {
+        p->zero = new_inst(p->f, IR_CONST, IT_I64);
+        insert_before(p->f->blocks->first, p->zero);
+    }
+    return p->zero;
+}
+
+static bool is_scalar(Type *ty) {
+    return ty->kind != TY_ARRAY && ty->kind != TY_STRUCT;
+}
+
+// Returns `val` as it reads back after a store of `size` bytes, which
+// truncates it. Comparisons are 0 or 1 and survive any store.
+static IrInst *truncated(Promotion *p, IrInst *store, IrInst *val, int size) {
+    if (size == 8 || (IR_EQ <= val->op && val->op <= IR_LE)) {
+        return val;
+    }
+    if (val->op == IR_CONST) {
+        long imm = size == 1 ? (signed char)val->imm : size == 2 ? (short)val->imm : (int)val->imm;
+        if (imm == val->imm) {
+            return val;
+        }
+        IrInst *c = new_inst(p->f, IR_CONST, IT_I64);
+        c->imm = imm;
+        insert_before(store, c);
+        return c;
+    }
+    IrInst *ext = new_inst(p->f, IR_SEXT, IT_I64);
+    ext->size = size;
+    ext->args = ir_grow(NULL, 0, sizeof(IrInst *));
+    ext->args[0] = val;
+    ext->num_args = 1;
+    insert_before(store, ext);
+    return ext;
+}
+
+// Replaces loads and stores of promoted variables in `bb` and in the
+// blocks it dominates. `vals` holds the current value of each variable.
+static void rename_block(Promotion *p, Block *bb, IrInst **in) {
+    IrInst **vals = malloc(sizeof(IrInst *) * (p->num_vars + 1));
+    memcpy(vals, in, sizeof(IrInst *) * p->num_vars);
+
+    IrInst *next;
+    for (IrInst *inst = bb->first; inst; inst = next) {
+        next = inst->next;
+        if (inst->op == IR_PHI) {
+            if (inst->id >= p->first_phi) {
+                vals[inst->imm] = inst;
+            }
+            continue;
+        }
+        for (int i = 0; i < inst->num_args; i++) {
+            inst->args[i] = resolve(inst->args[i]);
+        }
+
+        int v;
+        if (inst->op == IR_LOAD && (v = var_of(p, inst->args[0])) >= 0) {
+            inst->replaced = vals[v] ? vals[v] : zero(p);
+            remove_inst(inst);
+        } else if (inst->op == IR_STORE && (v = var_of(p, inst->args[0])) >= 0) {
+            vals[v] = truncated(p, inst, inst->args[1], inst->size);
+            remove_inst(inst);
+        }
+    }
+
+    for (int i = 0; i < bb->num_succs; i++) {
+        Block *succ = bb->succs[i];
+        for (int j = 0; j < succ->num_preds; j++) {
+            if (succ->preds[j] != bb) {
+                continue;
+            }
+            for (IrInst *phi = succ->first; phi && phi->op == IR_PHI; phi = phi->next) {
+                if (phi->id >= p->first_phi) {
+                    IrInst *val = vals[phi->imm];
+                    phi->args[j] = val ? val : zero(p);
+                }
+            }
+        }
+    }
+
+    BlockList *children = &p->children[bb->id];
+    for (int i = 0; i < children->len; i++) {
+        rename_block(p, children->blocks[i], vals);
+    }
+    free(vals);
+}
+
+// Removes phis that merge a single value, possibly with themselves,
+// and phis whose value is never used.
+static void remove_phis(Promotion *p) {
+    IrFunc *f = p->f;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (Block *bb = f->blocks; bb; bb = bb->next) {
+            IrInst *next;
+            for (IrInst *phi = bb->first; phi && phi->op == IR_PHI; phi = next) {
+                next = phi->next;
+                IrInst *same = NULL;
+                bool trivial = true;
+                for (int i = 0; i < phi->num_args; i++) {
+                    IrInst *arg = phi->args[i] = resolve(phi->args[i]);
+                    if (arg == phi || arg == same) {
+                        continue;
+                    }
+                    if (same) {
+                        trivial = false;
+                        break;
+                    }
+                    same = arg;
+                }
+                if (trivial) {
+                    phi->replaced = same ? same : zero(p);
+                    remove_inst(phi);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (Block *bb = f->blocks; bb; bb = bb->next) {
+            for (IrInst *inst = bb->first; inst; inst = inst->next) {
+                for (int i = 0; i < inst->num_args; i++) {
+                    inst->args[i] = resolve(inst->args[i]);
+                }
+            }
+        }
+        count_uses(f);
+        for (Block *bb = f->blocks; bb; bb = bb->next) {
+            IrInst *next;
+            for (IrInst *phi = bb->first; phi && phi->op == IR_PHI; phi = next) {
+                next = phi->next;
+                if (!phi->num_uses) {
+                    remove_inst(phi);
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+// Numbers the values in layout order.
+static void renumber(IrFunc *f) {
+    int n = 0;
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            inst->id = n++;
+        }
+    }
+    f->num_values = n;
+}
+
+void mem2reg(IrFunc *f) {
+    compute_dominators(f);
+    int n = f->num_blocks;
+
+    Promotion p = {0};
+    p.f = f;
+    p.num_ids = f->num_values;
+    p.var_of = calloc(p.num_ids, sizeof(int));
+
+    // A variable can be promoted if it is a scalar and its alloca is
+    // only ever used as the address of loads and stores.
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            if (inst->op == IR_ALLOCA) {
+                p.var_of[inst->id] = is_scalar(inst->var->ty) ? 0 : -1;
+            }
+        }
+    }
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            for (int i = 0; i < inst->num_args; i++) {
+                IrInst *arg = inst->args[i];
+                bool addr = i == 0 && (inst->op == IR_LOAD || inst->op == IR_STORE);
+                if (arg->op == IR_ALLOCA && !addr) {
+                    p.var_of[arg->id] = -1;
+                }
+            }
+        }
+    }
+    // Code may step from one local to the next with pointer arithmetic,
+    // as the stack machine keeps them side by side in declaration order.
+    // Once the address of a scalar escapes, all scalars stay in memory.
+    bool escaped = false;
+    for (IrInst *inst = f->blocks->first; inst; inst = inst->next) {
+        if (inst->op == IR_ALLOCA && is_scalar(inst->var->ty) && p.var_of[inst->id] < 0) {
+            escaped = true;
+        }
+    }
+    IrInst **vars = calloc(p.num_ids, sizeof(IrInst *));
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            if (inst->op != IR_ALLOCA || p.var_of[inst->id] < 0) {
+                continue;
+            }
+            if (escaped) {
+                p.var_of[inst->id] = -1;
+            } else {
+                vars[p.num_vars] = inst;
+                p.var_of[inst->id] = p.num_vars++;
+            }
+        }
+    }
+
+    // Dominance frontiers, by the method of Cooper, Harvey and Kennedy.
+    BlockList *df = calloc(n, sizeof(BlockList));
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        if (bb->num_preds < 2) {
+            continue;
+        }
+        for (int i = 0; i < bb->num_preds; i++) {
+            for (Block *b = bb->preds[i]; b != bb->idom; b = b->idom) {
+                add_block(&df[b->id], bb);
+            }
+        }
+    }
+
+    // Blocks that store to each variable.
+    BlockList *defs = calloc(p.num_vars + 1, sizeof(BlockList));
+    for (Block *bb = f->blocks; bb; bb = bb->next) {
+        for (IrInst *inst = bb->first; inst; inst = inst->next) {
+            int v;
+            if (inst->op == IR_STORE && (v = var_of(&p, inst->args[0])) >= 0) {
+                add_block(&defs[v], bb);
+            }
+        }
+    }
+
+    // Insert phis at the iterated dominance frontiers.
+    p.first_phi = f->num_values;
+    int *has_phi = calloc(n, sizeof(int));
+    int *queued = calloc(n, sizeof(int));
+    Block **work = calloc(n, sizeof(Block *));
+    for (int v = 0; v < p.num_vars; v++) {
+        int len = 0;
+        for (int i = 0; i < defs[v].len; i++) {
+            work[len++] = defs[v].blocks[i];
+            queued[defs[v].blocks[i]->id] = v + 1;
+        }
+        while (len > 0) {
+            Block *bb = work[--len];
+            for (int i = 0; i < df[bb->id].len; i++) {
+                Block *d = df[bb->id].blocks[i];
+                if (has_phi[d->id] == v + 1) {
+                    continue;
+                }
+                has_phi[d->id] = v + 1;
+                IrInst *phi = new_inst(f, IR_PHI, ir_type(vars[v]->var->ty));
+                phi->imm = v;
+                phi->num_args = d->num_preds;
+                phi->args = arena_alloc(&ir_arena, sizeof(IrInst *) * d->num_preds);
+                insert_before(d->first, phi);
+                if (queued[d->id] != v + 1) {
+                    queued[d->id] = v + 1;
+                    work[len++] = d;
+                }
+            }
+        }
+    }
+
+    p.children = calloc(n, sizeof(BlockList));
+    for (Block *bb = f->blocks->next; bb; bb = bb->next) {
+        add_block(&p.children[bb->idom->id], bb);
+    }
+    IrInst **vals = calloc(p.num_vars + 1, sizeof(IrInst *));
+    rename_block(&p, f->blocks, vals);
+
+    for (int v = 0; v < p.num_vars; v++) {
+        remove_inst(vars[v]);
+    }
+    remove_phis(&p);
+    renumber(f);
+
+    free(vals);
+    free(work);
+    free(queued);
+    free(has_phi);
+    free(defs);
+    free(df);
+    free(p.children);
+    free(vars);
+    free(p.var_of);
+}
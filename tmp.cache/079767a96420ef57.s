@@ -0,0 +1,5 @@
+.global ret3
+ret3:
+  mov rax, 3
+.Lreturn.ret3:
+  ret
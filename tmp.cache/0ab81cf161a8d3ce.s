@@ -0,0 +1,14108 @@
+.data
+.L.data.main.262:
+.byte 79
+.byte 75
+.byte 10
+.byte 0
+.L.data.main.261:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 52
+.byte 50
+.byte 57
+.byte 52
+.byte 57
+.byte 54
+.byte 55
+.byte 50
+.byte 57
+.byte 55
+.byte 41
+.byte 0
+.L.data.main.260:
+.byte 52
+.byte 50
+.byte 57
+.byte 52
+.byte 57
+.byte 54
+.byte 55
+.byte 50
+.byte 57
+.byte 55
+.byte 0
+.L.data.main.259:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 48
+.byte 41
+.byte 0
+.L.data.main.258:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 91
+.byte 51
+.byte 93
+.byte 91
+.byte 52
+.byte 93
+.byte 41
+.byte 0
+.L.data.main.257:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 91
+.byte 52
+.byte 93
+.byte 41
+.byte 0
+.L.data.main.256:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 40
+.byte 42
+.byte 41
+.byte 91
+.byte 52
+.byte 93
+.byte 41
+.byte 0
+.L.data.main.255:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 40
+.byte 42
+.byte 41
+.byte 91
+.byte 52
+.byte 93
+.byte 41
+.byte 0
+.L.data.main.254:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 42
+.byte 41
+.byte 0
+.L.data.main.253:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 42
+.byte 41
+.byte 0
+.L.data.main.252:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 41
+.byte 0
+.L.data.main.251:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 42
+.byte 41
+.byte 0
+.L.data.main.250:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 41
+.byte 0
+.L.data.main.249:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 41
+.byte 0
+.L.data.main.248:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 41
+.byte 0
+.L.data.main.247:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 41
+.byte 0
+.L.data.main.246:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 41
+.byte 0
+.L.data.main.245:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 41
+.byte 0
+.L.data.main.244:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 41
+.byte 0
+.L.data.main.243:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 41
+.byte 0
+.L.data.main.242:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.241:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.240:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 32
+.byte 116
+.byte 59
+.byte 32
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.239:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.238:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.237:
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.236:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.235:
+.byte 95
+.byte 66
+.byte 111
+.byte 111
+.byte 108
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.234:
+.byte 95
+.byte 66
+.byte 111
+.byte 111
+.byte 108
+.byte 32
+.byte 120
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.233:
+.byte 95
+.byte 66
+.byte 111
+.byte 111
+.byte 108
+.byte 32
+.byte 120
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.232:
+.byte 42
+.byte 103
+.byte 49
+.byte 95
+.byte 112
+.byte 116
+.byte 114
+.byte 40
+.byte 41
+.byte 0
+.L.data.main.231:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 40
+.byte 42
+.byte 121
+.byte 41
+.byte 91
+.byte 51
+.byte 93
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 48
+.byte 93
+.byte 91
+.byte 48
+.byte 93
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 48
+.byte 93
+.byte 91
+.byte 48
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.230:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 48
+.byte 93
+.byte 61
+.byte 38
+.byte 121
+.byte 59
+.byte 32
+.byte 121
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 48
+.byte 93
+.byte 91
+.byte 48
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.229:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 40
+.byte 42
+.byte 120
+.byte 41
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.228:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.227:
+.byte 115
+.byte 117
+.byte 98
+.byte 95
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 40
+.byte 55
+.byte 44
+.byte 32
+.byte 51
+.byte 44
+.byte 32
+.byte 51
+.byte 41
+.byte 0
+.L.data.main.226:
+.byte 115
+.byte 117
+.byte 98
+.byte 95
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 40
+.byte 55
+.byte 44
+.byte 32
+.byte 51
+.byte 44
+.byte 32
+.byte 51
+.byte 41
+.byte 0
+.L.data.main.225:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 98
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.224:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.223:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.222:
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.221:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 121
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.220:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 121
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.219:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 125
+.byte 32
+.byte 116
+.byte 59
+.byte 32
+.byte 123
+.byte 32
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 59
+.byte 32
+.byte 125
+.byte 32
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.218:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 59
+.byte 32
+.byte 116
+.byte 32
+.byte 116
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 116
+.byte 59
+.byte 0
+.L.data.main.217:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 125
+.byte 32
+.byte 116
+.byte 59
+.byte 32
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.216:
+.byte 116
+.byte 121
+.byte 112
+.byte 101
+.byte 100
+.byte 101
+.byte 102
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 59
+.byte 32
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.215:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 32
+.byte 61
+.byte 32
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 45
+.byte 62
+.byte 97
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.214:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 32
+.byte 61
+.byte 32
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 121
+.byte 45
+.byte 62
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.213:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 125
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 116
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 121
+.byte 46
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 116
+.byte 43
+.byte 121
+.byte 46
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.212:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 91
+.byte 50
+.byte 93
+.byte 59
+.byte 125
+.byte 59
+.byte 32
+.byte 123
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 125
+.byte 59
+.byte 32
+.byte 125
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 121
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.211:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 121
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.210:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 121
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.209:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 61
+.byte 38
+.byte 121
+.byte 59
+.byte 32
+.byte 98
+.byte 45
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.208:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 121
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 61
+.byte 38
+.byte 121
+.byte 59
+.byte 32
+.byte 98
+.byte 45
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.207:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.206:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.205:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.204:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 125
+.byte 59
+.byte 0
+.L.data.main.203:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.202:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.201:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.200:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.199:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 32
+.byte 125
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 46
+.byte 98
+.byte 61
+.byte 54
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 46
+.byte 98
+.byte 59
+.byte 0
+.L.data.main.198:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 91
+.byte 53
+.byte 93
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 91
+.byte 48
+.byte 93
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 112
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.197:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 91
+.byte 53
+.byte 93
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 91
+.byte 48
+.byte 93
+.byte 61
+.byte 54
+.byte 59
+.byte 32
+.byte 112
+.byte 91
+.byte 48
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.196:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 112
+.byte 91
+.byte 51
+.byte 93
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 46
+.byte 98
+.byte 59
+.byte 0
+.L.data.main.195:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 112
+.byte 91
+.byte 50
+.byte 93
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.194:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 112
+.byte 91
+.byte 49
+.byte 93
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 48
+.byte 93
+.byte 46
+.byte 98
+.byte 59
+.byte 0
+.L.data.main.193:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 112
+.byte 91
+.byte 48
+.byte 93
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 48
+.byte 93
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.192:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 99
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 99
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 99
+.byte 59
+.byte 0
+.L.data.main.191:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 99
+.byte 59
+.byte 125
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 59
+.byte 0
+.L.data.main.190:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 99
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 99
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.189:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 59
+.byte 0
+.L.data.main.188:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 98
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.187:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 123
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.186:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 123
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 125
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.185:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 123
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 125
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.184:
+.byte 34
+.byte 92
+.byte 108
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.183:
+.byte 108
+.byte 0
+.L.data.main.182:
+.byte 34
+.byte 92
+.byte 107
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.181:
+.byte 107
+.byte 0
+.L.data.main.180:
+.byte 34
+.byte 92
+.byte 106
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.179:
+.byte 106
+.byte 0
+.L.data.main.178:
+.byte 34
+.byte 92
+.byte 48
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.177:
+.byte 0
+.byte 0
+.L.data.main.176:
+.byte 34
+.byte 92
+.byte 101
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.175:
+.byte 27
+.byte 0
+.L.data.main.174:
+.byte 34
+.byte 92
+.byte 114
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.173:
+.byte 13
+.byte 0
+.L.data.main.172:
+.byte 34
+.byte 92
+.byte 102
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.171:
+.byte 12
+.byte 0
+.L.data.main.170:
+.byte 34
+.byte 92
+.byte 118
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.169:
+.byte 11
+.byte 0
+.L.data.main.168:
+.byte 34
+.byte 92
+.byte 110
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.167:
+.byte 10
+.byte 0
+.L.data.main.166:
+.byte 34
+.byte 92
+.byte 116
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.165:
+.byte 9
+.byte 0
+.L.data.main.164:
+.byte 34
+.byte 92
+.byte 98
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.163:
+.byte 8
+.byte 0
+.L.data.main.162:
+.byte 34
+.byte 92
+.byte 97
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.161:
+.byte 7
+.byte 0
+.L.data.main.160:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 34
+.byte 97
+.byte 98
+.byte 99
+.byte 34
+.byte 41
+.byte 0
+.L.data.main.159:
+.byte 97
+.byte 98
+.byte 99
+.byte 0
+.L.data.main.158:
+.byte 34
+.byte 97
+.byte 98
+.byte 99
+.byte 34
+.byte 91
+.byte 51
+.byte 93
+.byte 0
+.L.data.main.157:
+.byte 97
+.byte 98
+.byte 99
+.byte 0
+.L.data.main.156:
+.byte 34
+.byte 97
+.byte 98
+.byte 99
+.byte 34
+.byte 91
+.byte 50
+.byte 93
+.byte 0
+.L.data.main.155:
+.byte 97
+.byte 98
+.byte 99
+.byte 0
+.L.data.main.154:
+.byte 34
+.byte 97
+.byte 98
+.byte 99
+.byte 34
+.byte 91
+.byte 49
+.byte 93
+.byte 0
+.L.data.main.153:
+.byte 97
+.byte 98
+.byte 99
+.byte 0
+.L.data.main.152:
+.byte 34
+.byte 97
+.byte 98
+.byte 99
+.byte 34
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.151:
+.byte 97
+.byte 98
+.byte 99
+.byte 0
+.L.data.main.150:
+.byte 115
+.byte 117
+.byte 98
+.byte 95
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 40
+.byte 55
+.byte 44
+.byte 32
+.byte 51
+.byte 44
+.byte 32
+.byte 51
+.byte 41
+.byte 0
+.L.data.main.149:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 48
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.148:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.147:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 120
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 121
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 121
+.byte 59
+.byte 0
+.L.data.main.146:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 120
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 121
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.145:
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 120
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.144:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 103
+.byte 50
+.byte 41
+.byte 0
+.L.data.main.143:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 103
+.byte 49
+.byte 41
+.byte 0
+.L.data.main.142:
+.byte 103
+.byte 50
+.byte 91
+.byte 51
+.byte 93
+.byte 0
+.L.data.main.141:
+.byte 103
+.byte 50
+.byte 91
+.byte 50
+.byte 93
+.byte 0
+.L.data.main.140:
+.byte 103
+.byte 50
+.byte 91
+.byte 49
+.byte 93
+.byte 0
+.L.data.main.139:
+.byte 103
+.byte 50
+.byte 91
+.byte 48
+.byte 93
+.byte 0
+.L.data.main.138:
+.byte 103
+.byte 49
+.byte 0
+.L.data.main.137:
+.byte 103
+.byte 49
+.byte 0
+.L.data.main.136:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 42
+.byte 42
+.byte 120
+.byte 32
+.byte 43
+.byte 32
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.135:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 32
+.byte 42
+.byte 42
+.byte 120
+.byte 32
+.byte 43
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+.L.data.main.134:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 42
+.byte 42
+.byte 120
+.byte 41
+.byte 32
+.byte 43
+.byte 32
+.byte 49
+.byte 59
+.byte 0
+.L.data.main.133:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 42
+.byte 42
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.132:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 42
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.131:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.130:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 52
+.byte 93
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.129:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.128:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.127:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 59
+.byte 32
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.126:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 54
+.byte 93
+.byte 61
+.byte 54
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 48
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.125:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 53
+.byte 93
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 91
+.byte 50
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.124:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 52
+.byte 93
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 91
+.byte 49
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.123:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 51
+.byte 93
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 91
+.byte 48
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.122:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 50
+.byte 93
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 48
+.byte 93
+.byte 91
+.byte 50
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.121:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 49
+.byte 93
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 48
+.byte 93
+.byte 91
+.byte 49
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.120:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 121
+.byte 91
+.byte 48
+.byte 93
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 48
+.byte 93
+.byte 91
+.byte 48
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.119:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 50
+.byte 91
+.byte 120
+.byte 93
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.118:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.117:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.116:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.115:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.114:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 121
+.byte 43
+.byte 54
+.byte 41
+.byte 61
+.byte 54
+.byte 59
+.byte 32
+.byte 42
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.113:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 121
+.byte 43
+.byte 53
+.byte 41
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 43
+.byte 50
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.112:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 121
+.byte 43
+.byte 52
+.byte 41
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 43
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.111:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 121
+.byte 43
+.byte 51
+.byte 41
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 42
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.110:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 121
+.byte 43
+.byte 50
+.byte 41
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 42
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.109:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 121
+.byte 43
+.byte 49
+.byte 41
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 42
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.108:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 42
+.byte 42
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.107:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.106:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.105:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 61
+.byte 52
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 120
+.byte 43
+.byte 50
+.byte 41
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.104:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 91
+.byte 50
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 42
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.103:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 97
+.byte 100
+.byte 100
+.byte 120
+.byte 40
+.byte 38
+.byte 120
+.byte 44
+.byte 32
+.byte 121
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.102:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 38
+.byte 121
+.byte 45
+.byte 49
+.byte 41
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.101:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 38
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 121
+.byte 59
+.byte 0
+.L.data.main.100:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.99:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 122
+.byte 61
+.byte 38
+.byte 121
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 122
+.byte 45
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.98:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 122
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 122
+.byte 43
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.97:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 38
+.byte 121
+.byte 45
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.96:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 49
+.byte 43
+.byte 38
+.byte 120
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.95:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 42
+.byte 40
+.byte 38
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.94:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 121
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 42
+.byte 122
+.byte 61
+.byte 38
+.byte 121
+.byte 59
+.byte 32
+.byte 42
+.byte 42
+.byte 122
+.byte 59
+.byte 0
+.L.data.main.93:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 42
+.byte 38
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.92:
+.byte 97
+.byte 100
+.byte 100
+.byte 54
+.byte 40
+.byte 49
+.byte 44
+.byte 50
+.byte 44
+.byte 51
+.byte 44
+.byte 52
+.byte 44
+.byte 53
+.byte 44
+.byte 97
+.byte 100
+.byte 100
+.byte 54
+.byte 40
+.byte 49
+.byte 44
+.byte 50
+.byte 44
+.byte 51
+.byte 44
+.byte 52
+.byte 44
+.byte 53
+.byte 44
+.byte 49
+.byte 43
+.byte 40
+.byte 50
+.byte 43
+.byte 40
+.byte 51
+.byte 43
+.byte 40
+.byte 52
+.byte 43
+.byte 40
+.byte 53
+.byte 43
+.byte 40
+.byte 54
+.byte 43
+.byte 55
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 0
+.L.data.main.91:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 49
+.byte 43
+.byte 40
+.byte 50
+.byte 43
+.byte 40
+.byte 51
+.byte 43
+.byte 40
+.byte 52
+.byte 43
+.byte 40
+.byte 53
+.byte 43
+.byte 40
+.byte 54
+.byte 43
+.byte 40
+.byte 55
+.byte 43
+.byte 40
+.byte 56
+.byte 43
+.byte 40
+.byte 57
+.byte 43
+.byte 120
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.90:
+.byte 49
+.byte 32
+.byte 43
+.byte 32
+.byte 99
+.byte 108
+.byte 97
+.byte 109
+.byte 112
+.byte 40
+.byte 51
+.byte 44
+.byte 32
+.byte 53
+.byte 44
+.byte 32
+.byte 57
+.byte 41
+.byte 32
+.byte 42
+.byte 32
+.byte 50
+.byte 32
+.byte 43
+.byte 32
+.byte 99
+.byte 108
+.byte 97
+.byte 109
+.byte 112
+.byte 50
+.byte 40
+.byte 48
+.byte 41
+.byte 32
+.byte 45
+.byte 32
+.byte 51
+.byte 0
+.L.data.main.89:
+.byte 114
+.byte 117
+.byte 110
+.byte 95
+.byte 99
+.byte 97
+.byte 108
+.byte 108
+.byte 95
+.byte 108
+.byte 97
+.byte 116
+.byte 101
+.byte 114
+.byte 40
+.byte 53
+.byte 41
+.byte 0
+.L.data.main.88:
+.byte 115
+.byte 117
+.byte 109
+.byte 95
+.byte 100
+.byte 111
+.byte 119
+.byte 110
+.byte 40
+.byte 52
+.byte 41
+.byte 0
+.L.data.main.87:
+.byte 100
+.byte 101
+.byte 97
+.byte 100
+.byte 95
+.byte 99
+.byte 111
+.byte 100
+.byte 101
+.byte 40
+.byte 51
+.byte 41
+.byte 0
+.L.data.main.86:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 119
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 40
+.byte 49
+.byte 41
+.byte 41
+.byte 0
+.L.data.main.85:
+.byte 119
+.byte 105
+.byte 100
+.byte 101
+.byte 110
+.byte 40
+.byte 52
+.byte 50
+.byte 57
+.byte 52
+.byte 57
+.byte 54
+.byte 55
+.byte 50
+.byte 57
+.byte 55
+.byte 41
+.byte 0
+.L.data.main.84:
+.byte 108
+.byte 111
+.byte 119
+.byte 95
+.byte 98
+.byte 121
+.byte 116
+.byte 101
+.byte 40
+.byte 51
+.byte 48
+.byte 48
+.byte 41
+.byte 0
+.L.data.main.83:
+.byte 99
+.byte 108
+.byte 97
+.byte 109
+.byte 112
+.byte 50
+.byte 40
+.byte 45
+.byte 50
+.byte 41
+.byte 0
+.L.data.main.82:
+.byte 99
+.byte 108
+.byte 97
+.byte 109
+.byte 112
+.byte 50
+.byte 40
+.byte 56
+.byte 41
+.byte 0
+.L.data.main.81:
+.byte 105
+.byte 115
+.byte 113
+.byte 114
+.byte 116
+.byte 40
+.byte 53
+.byte 48
+.byte 41
+.byte 0
+.L.data.main.80:
+.byte 105
+.byte 115
+.byte 113
+.byte 114
+.byte 116
+.byte 40
+.byte 52
+.byte 57
+.byte 41
+.byte 0
+.L.data.main.79:
+.byte 99
+.byte 108
+.byte 97
+.byte 109
+.byte 112
+.byte 40
+.byte 52
+.byte 44
+.byte 32
+.byte 48
+.byte 44
+.byte 32
+.byte 49
+.byte 48
+.byte 41
+.byte 0
+.L.data.main.78:
+.byte 99
+.byte 108
+.byte 97
+.byte 109
+.byte 112
+.byte 40
+.byte 49
+.byte 50
+.byte 44
+.byte 32
+.byte 48
+.byte 44
+.byte 32
+.byte 49
+.byte 48
+.byte 41
+.byte 0
+.L.data.main.77:
+.byte 99
+.byte 108
+.byte 97
+.byte 109
+.byte 112
+.byte 40
+.byte 45
+.byte 51
+.byte 44
+.byte 32
+.byte 48
+.byte 44
+.byte 32
+.byte 49
+.byte 48
+.byte 41
+.byte 0
+.L.data.main.76:
+.byte 102
+.byte 105
+.byte 98
+.byte 40
+.byte 57
+.byte 41
+.byte 0
+.L.data.main.75:
+.byte 97
+.byte 100
+.byte 100
+.byte 54
+.byte 40
+.byte 49
+.byte 44
+.byte 50
+.byte 44
+.byte 51
+.byte 44
+.byte 52
+.byte 44
+.byte 53
+.byte 44
+.byte 54
+.byte 41
+.byte 0
+.L.data.main.74:
+.byte 115
+.byte 117
+.byte 98
+.byte 40
+.byte 53
+.byte 44
+.byte 32
+.byte 51
+.byte 41
+.byte 0
+.L.data.main.73:
+.byte 97
+.byte 100
+.byte 100
+.byte 40
+.byte 51
+.byte 44
+.byte 32
+.byte 53
+.byte 41
+.byte 0
+.L.data.main.72:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 106
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 40
+.byte 105
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 60
+.byte 61
+.byte 49
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 61
+.byte 105
+.byte 43
+.byte 49
+.byte 41
+.byte 32
+.byte 106
+.byte 61
+.byte 105
+.byte 43
+.byte 106
+.byte 59
+.byte 32
+.byte 106
+.byte 59
+.byte 0
+.L.data.main.71:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 106
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 40
+.byte 105
+.byte 60
+.byte 61
+.byte 49
+.byte 48
+.byte 41
+.byte 32
+.byte 123
+.byte 106
+.byte 61
+.byte 105
+.byte 43
+.byte 106
+.byte 59
+.byte 32
+.byte 105
+.byte 61
+.byte 105
+.byte 43
+.byte 49
+.byte 59
+.byte 125
+.byte 32
+.byte 106
+.byte 59
+.byte 0
+.L.data.main.70:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 40
+.byte 105
+.byte 60
+.byte 49
+.byte 48
+.byte 41
+.byte 32
+.byte 105
+.byte 61
+.byte 105
+.byte 43
+.byte 49
+.byte 59
+.byte 32
+.byte 105
+.byte 59
+.byte 0
+.L.data.main.69:
+.byte 49
+.byte 59
+.byte 32
+.byte 123
+.byte 50
+.byte 59
+.byte 125
+.byte 32
+.byte 51
+.byte 59
+.byte 0
+.L.data.main.68:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 120
+.byte 62
+.byte 61
+.byte 53
+.byte 61
+.byte 61
+.byte 49
+.byte 59
+.byte 0
+.L.data.main.67:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 114
+.byte 32
+.byte 40
+.byte 59
+.byte 32
+.byte 48
+.byte 61
+.byte 61
+.byte 40
+.byte 49
+.byte 48
+.byte 60
+.byte 61
+.byte 105
+.byte 41
+.byte 59
+.byte 41
+.byte 32
+.byte 105
+.byte 61
+.byte 105
+.byte 43
+.byte 49
+.byte 59
+.byte 32
+.byte 105
+.byte 59
+.byte 0
+.L.data.main.66:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 119
+.byte 104
+.byte 105
+.byte 108
+.byte 101
+.byte 32
+.byte 40
+.byte 40
+.byte 105
+.byte 60
+.byte 49
+.byte 48
+.byte 41
+.byte 33
+.byte 61
+.byte 48
+.byte 41
+.byte 32
+.byte 105
+.byte 61
+.byte 105
+.byte 43
+.byte 49
+.byte 59
+.byte 32
+.byte 105
+.byte 59
+.byte 0
+.L.data.main.65:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 38
+.byte 120
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 112
+.byte 33
+.byte 61
+.byte 48
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.64:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 121
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 120
+.byte 45
+.byte 53
+.byte 61
+.byte 61
+.byte 121
+.byte 45
+.byte 49
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.63:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 40
+.byte 40
+.byte 120
+.byte 33
+.byte 61
+.byte 53
+.byte 41
+.byte 61
+.byte 61
+.byte 48
+.byte 41
+.byte 33
+.byte 61
+.byte 48
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.62:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 48
+.byte 61
+.byte 61
+.byte 40
+.byte 120
+.byte 61
+.byte 61
+.byte 53
+.byte 41
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.61:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 40
+.byte 120
+.byte 60
+.byte 51
+.byte 41
+.byte 61
+.byte 61
+.byte 48
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.60:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 53
+.byte 62
+.byte 61
+.byte 120
+.byte 43
+.byte 49
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.59:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 48
+.byte 60
+.byte 120
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.58:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 120
+.byte 62
+.byte 51
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.57:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 120
+.byte 60
+.byte 51
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.56:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 50
+.byte 45
+.byte 49
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.55:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 49
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.54:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 49
+.byte 45
+.byte 49
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.53:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 48
+.byte 59
+.byte 32
+.byte 105
+.byte 102
+.byte 32
+.byte 40
+.byte 48
+.byte 41
+.byte 32
+.byte 120
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 101
+.byte 108
+.byte 115
+.byte 101
+.byte 32
+.byte 120
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.52:
+.byte 114
+.byte 101
+.byte 116
+.byte 51
+.byte 40
+.byte 41
+.byte 59
+.byte 0
+.L.data.main.51:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 102
+.byte 111
+.byte 111
+.byte 49
+.byte 50
+.byte 51
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 97
+.byte 114
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 111
+.byte 49
+.byte 50
+.byte 51
+.byte 43
+.byte 98
+.byte 97
+.byte 114
+.byte 59
+.byte 0
+.L.data.main.50:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 102
+.byte 111
+.byte 111
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 102
+.byte 111
+.byte 111
+.byte 59
+.byte 0
+.L.data.main.49:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 122
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 97
+.byte 43
+.byte 122
+.byte 59
+.byte 0
+.L.data.main.48:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.47:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 122
+.byte 59
+.byte 32
+.byte 97
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 122
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 97
+.byte 43
+.byte 122
+.byte 59
+.byte 0
+.L.data.main.46:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 97
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.45:
+.byte 49
+.byte 62
+.byte 61
+.byte 50
+.byte 0
+.L.data.main.44:
+.byte 49
+.byte 62
+.byte 61
+.byte 49
+.byte 0
+.L.data.main.43:
+.byte 49
+.byte 62
+.byte 61
+.byte 48
+.byte 0
+.L.data.main.42:
+.byte 49
+.byte 62
+.byte 50
+.byte 0
+.L.data.main.41:
+.byte 49
+.byte 62
+.byte 49
+.byte 0
+.L.data.main.40:
+.byte 49
+.byte 62
+.byte 48
+.byte 0
+.L.data.main.39:
+.byte 50
+.byte 60
+.byte 61
+.byte 49
+.byte 0
+.L.data.main.38:
+.byte 49
+.byte 60
+.byte 61
+.byte 49
+.byte 0
+.L.data.main.37:
+.byte 48
+.byte 60
+.byte 61
+.byte 49
+.byte 0
+.L.data.main.36:
+.byte 50
+.byte 60
+.byte 49
+.byte 0
+.L.data.main.35:
+.byte 49
+.byte 60
+.byte 49
+.byte 0
+.L.data.main.34:
+.byte 48
+.byte 60
+.byte 49
+.byte 0
+.L.data.main.33:
+.byte 52
+.byte 50
+.byte 33
+.byte 61
+.byte 52
+.byte 50
+.byte 0
+.L.data.main.32:
+.byte 48
+.byte 33
+.byte 61
+.byte 49
+.byte 0
+.L.data.main.31:
+.byte 52
+.byte 50
+.byte 61
+.byte 61
+.byte 52
+.byte 50
+.byte 0
+.L.data.main.30:
+.byte 48
+.byte 61
+.byte 61
+.byte 49
+.byte 0
+.L.data.main.29:
+.byte 45
+.byte 32
+.byte 45
+.byte 32
+.byte 43
+.byte 49
+.byte 48
+.byte 0
+.L.data.main.28:
+.byte 45
+.byte 32
+.byte 45
+.byte 49
+.byte 48
+.byte 0
+.L.data.main.27:
+.byte 48
+.byte 0
+.L.data.main.26:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 48
+.byte 43
+.byte 120
+.byte 42
+.byte 49
+.byte 45
+.byte 48
+.byte 59
+.byte 0
+.L.data.main.25:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 120
+.byte 45
+.byte 49
+.byte 43
+.byte 50
+.byte 59
+.byte 0
+.L.data.main.24:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 120
+.byte 43
+.byte 49
+.byte 43
+.byte 50
+.byte 59
+.byte 0
+.L.data.main.23:
+.byte 115
+.byte 105
+.byte 122
+.byte 101
+.byte 111
+.byte 102
+.byte 40
+.byte 105
+.byte 110
+.byte 116
+.byte 41
+.byte 42
+.byte 52
+.byte 43
+.byte 50
+.byte 0
+.L.data.main.22:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 99
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 49
+.byte 93
+.byte 46
+.byte 97
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 61
+.byte 49
+.byte 59
+.byte 32
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 99
+.byte 59
+.byte 125
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 120
+.byte 43
+.byte 50
+.byte 59
+.byte 32
+.byte 112
+.byte 61
+.byte 112
+.byte 45
+.byte 105
+.byte 59
+.byte 32
+.byte 40
+.byte 42
+.byte 112
+.byte 41
+.byte 46
+.byte 97
+.byte 59
+.byte 0
+.L.data.main.21:
+.byte 115
+.byte 116
+.byte 114
+.byte 117
+.byte 99
+.byte 116
+.byte 32
+.byte 123
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 97
+.byte 59
+.byte 32
+.byte 115
+.byte 104
+.byte 111
+.byte 114
+.byte 116
+.byte 32
+.byte 98
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 99
+.byte 59
+.byte 125
+.byte 32
+.byte 120
+.byte 91
+.byte 51
+.byte 93
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 105
+.byte 61
+.byte 50
+.byte 59
+.byte 32
+.byte 120
+.byte 91
+.byte 105
+.byte 93
+.byte 46
+.byte 99
+.byte 61
+.byte 57
+.byte 59
+.byte 32
+.byte 99
+.byte 104
+.byte 97
+.byte 114
+.byte 32
+.byte 42
+.byte 112
+.byte 61
+.byte 120
+.byte 59
+.byte 32
+.byte 112
+.byte 91
+.byte 49
+.byte 54
+.byte 93
+.byte 59
+.byte 0
+.L.data.main.20:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 45
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.19:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 45
+.byte 49
+.byte 50
+.byte 42
+.byte 120
+.byte 59
+.byte 0
+.L.data.main.18:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 42
+.byte 53
+.byte 59
+.byte 0
+.L.data.main.17:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 120
+.byte 61
+.byte 52
+.byte 50
+.byte 57
+.byte 52
+.byte 57
+.byte 54
+.byte 55
+.byte 50
+.byte 57
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 50
+.byte 49
+.byte 52
+.byte 55
+.byte 52
+.byte 56
+.byte 51
+.byte 54
+.byte 52
+.byte 55
+.byte 59
+.byte 0
+.L.data.main.16:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 120
+.byte 61
+.byte 45
+.byte 52
+.byte 50
+.byte 57
+.byte 52
+.byte 57
+.byte 54
+.byte 55
+.byte 50
+.byte 57
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 49
+.byte 48
+.byte 55
+.byte 51
+.byte 55
+.byte 52
+.byte 49
+.byte 56
+.byte 50
+.byte 52
+.byte 59
+.byte 0
+.L.data.main.15:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 120
+.byte 61
+.byte 45
+.byte 49
+.byte 48
+.byte 48
+.byte 48
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 56
+.byte 59
+.byte 0
+.L.data.main.14:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 45
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 45
+.byte 49
+.byte 59
+.byte 0
+.L.data.main.13:
+.byte 108
+.byte 111
+.byte 110
+.byte 103
+.byte 32
+.byte 120
+.byte 61
+.byte 45
+.byte 49
+.byte 48
+.byte 48
+.byte 48
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 54
+.byte 52
+.byte 49
+.byte 59
+.byte 0
+.L.data.main.12:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 45
+.byte 51
+.byte 59
+.byte 0
+.L.data.main.11:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 45
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 51
+.byte 59
+.byte 0
+.L.data.main.10:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 50
+.byte 59
+.byte 0
+.L.data.main.9:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 120
+.byte 61
+.byte 45
+.byte 55
+.byte 59
+.byte 32
+.byte 120
+.byte 47
+.byte 50
+.byte 59
+.byte 0
+.L.data.main.8:
+.byte 45
+.byte 55
+.byte 47
+.byte 50
+.byte 0
+.L.data.main.7:
+.byte 40
+.byte 51
+.byte 43
+.byte 53
+.byte 41
+.byte 47
+.byte 50
+.byte 0
+.L.data.main.6:
+.byte 53
+.byte 42
+.byte 40
+.byte 57
+.byte 45
+.byte 54
+.byte 41
+.byte 0
+.L.data.main.5:
+.byte 48
+.byte 0
+.L.data.main.4:
+.byte 32
+.byte 49
+.byte 50
+.byte 32
+.byte 43
+.byte 32
+.byte 51
+.byte 52
+.byte 32
+.byte 45
+.byte 32
+.byte 53
+.byte 32
+.byte 0
+.L.data.main.3:
+.byte 48
+.byte 0
+.L.data.main.2:
+.byte 102
+.byte 111
+.byte 114
+.byte 116
+.byte 121
+.byte 45
+.byte 116
+.byte 119
+.byte 111
+.byte 0
+.L.data.main.1:
+.byte 48
+.byte 0
+.L.data.main.0:
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 97
+.byte 61
+.byte 51
+.byte 59
+.byte 32
+.byte 105
+.byte 110
+.byte 116
+.byte 32
+.byte 122
+.byte 61
+.byte 53
+.byte 59
+.byte 32
+.byte 97
+.byte 43
+.byte 122
+.byte 59
+.byte 0
+.text
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 10304
+  mov qword ptr [rbp-8288], 8
+  lea rdi, [rbp-8296]
+  mov dword ptr [rbp-10304], 3
+  mov dword ptr [rbp-10300], 5
+  movsxd rsi, dword ptr [rbp-10304]
+  movsxd r10, dword ptr [rbp-10300]
+  add rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.0]
+  mov qword ptr [rbp-8304], rsi
+  mov rdi, qword ptr [rbp-8288]
+  mov rsi, qword ptr [rbp-8296]
+  cmp rdi, rsi
+  jne .Lelse.main.0
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8304]
+  mov rdx, qword ptr [rbp-8296]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.0
+.Lelse.main.0:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8304]
+  mov r10, qword ptr [rbp-8288]
+  mov rcx, qword ptr [rbp-8296]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.0:
+  mov qword ptr [rbp-8256], 0
+  mov qword ptr [rbp-8264], 0
+  lea rsi, [rip+.L.data.main.1]
+  mov qword ptr [rbp-8272], rsi
+  mov rdi, qword ptr [rbp-8256]
+  mov rsi, qword ptr [rbp-8264]
+  cmp rdi, rsi
+  jne .Lelse.main.1
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8272]
+  mov rdx, qword ptr [rbp-8264]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.1
+.Lelse.main.1:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8272]
+  mov r10, qword ptr [rbp-8256]
+  mov rcx, qword ptr [rbp-8264]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.1:
+  mov qword ptr [rbp-8224], 42
+  mov qword ptr [rbp-8232], 42
+  lea rsi, [rip+.L.data.main.2]
+  mov qword ptr [rbp-8240], rsi
+  mov rdi, qword ptr [rbp-8224]
+  mov rsi, qword ptr [rbp-8232]
+  cmp rdi, rsi
+  jne .Lelse.main.2
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8240]
+  mov rdx, qword ptr [rbp-8232]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.2
+.Lelse.main.2:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8240]
+  mov r10, qword ptr [rbp-8224]
+  mov rcx, qword ptr [rbp-8232]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.2:
+  mov qword ptr [rbp-8192], 5
+  mov qword ptr [rbp-8200], 5
+  lea rsi, [rip+.L.data.main.3]
+  mov qword ptr [rbp-8208], rsi
+  mov rdi, qword ptr [rbp-8192]
+  mov rsi, qword ptr [rbp-8200]
+  cmp rdi, rsi
+  jne .Lelse.main.3
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8208]
+  mov rdx, qword ptr [rbp-8200]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.3
+.Lelse.main.3:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8208]
+  mov r10, qword ptr [rbp-8192]
+  mov rcx, qword ptr [rbp-8200]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.3:
+  mov qword ptr [rbp-8160], 41
+  mov qword ptr [rbp-8168], 41
+  lea rsi, [rip+.L.data.main.4]
+  mov qword ptr [rbp-8176], rsi
+  mov rdi, qword ptr [rbp-8160]
+  mov rsi, qword ptr [rbp-8168]
+  cmp rdi, rsi
+  jne .Lelse.main.4
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8176]
+  mov rdx, qword ptr [rbp-8168]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.4
+.Lelse.main.4:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8176]
+  mov r10, qword ptr [rbp-8160]
+  mov rcx, qword ptr [rbp-8168]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.4:
+  mov qword ptr [rbp-8128], 5
+  mov qword ptr [rbp-8136], 5
+  lea rsi, [rip+.L.data.main.5]
+  mov qword ptr [rbp-8144], rsi
+  mov rdi, qword ptr [rbp-8128]
+  mov rsi, qword ptr [rbp-8136]
+  cmp rdi, rsi
+  jne .Lelse.main.5
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8144]
+  mov rdx, qword ptr [rbp-8136]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.5
+.Lelse.main.5:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8144]
+  mov r10, qword ptr [rbp-8128]
+  mov rcx, qword ptr [rbp-8136]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.5:
+  mov qword ptr [rbp-8096], 15
+  mov qword ptr [rbp-8104], 15
+  lea rsi, [rip+.L.data.main.6]
+  mov qword ptr [rbp-8112], rsi
+  mov rdi, qword ptr [rbp-8096]
+  mov rsi, qword ptr [rbp-8104]
+  cmp rdi, rsi
+  jne .Lelse.main.6
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8112]
+  mov rdx, qword ptr [rbp-8104]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.6
+.Lelse.main.6:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8112]
+  mov r10, qword ptr [rbp-8096]
+  mov rcx, qword ptr [rbp-8104]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.6:
+  mov qword ptr [rbp-8064], 4
+  mov qword ptr [rbp-8072], 4
+  lea rsi, [rip+.L.data.main.7]
+  mov qword ptr [rbp-8080], rsi
+  mov rdi, qword ptr [rbp-8064]
+  mov rsi, qword ptr [rbp-8072]
+  cmp rdi, rsi
+  jne .Lelse.main.7
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8080]
+  mov rdx, qword ptr [rbp-8072]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.7
+.Lelse.main.7:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8080]
+  mov r10, qword ptr [rbp-8064]
+  mov rcx, qword ptr [rbp-8072]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.7:
+  mov qword ptr [rbp-8032], -3
+  mov qword ptr [rbp-8040], -3
+  lea rsi, [rip+.L.data.main.8]
+  mov qword ptr [rbp-8048], rsi
+  mov rdi, qword ptr [rbp-8032]
+  mov rsi, qword ptr [rbp-8040]
+  cmp rdi, rsi
+  jne .Lelse.main.8
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8048]
+  mov rdx, qword ptr [rbp-8040]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.8
+.Lelse.main.8:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8048]
+  mov r10, qword ptr [rbp-8032]
+  mov rcx, qword ptr [rbp-8040]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.8:
+  mov qword ptr [rbp-8000], -3
+  lea rdi, [rbp-8008]
+  mov dword ptr [rbp-10296], -7
+  movsxd rsi, dword ptr [rbp-10296]
+  mov rax, rsi
+  shr rax, 63
+  add rsi, rax
+  sar rsi, 1
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.9]
+  mov qword ptr [rbp-8016], rsi
+  mov rdi, qword ptr [rbp-8000]
+  mov rsi, qword ptr [rbp-8008]
+  cmp rdi, rsi
+  jne .Lelse.main.9
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8016]
+  mov rdx, qword ptr [rbp-8008]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.9
+.Lelse.main.9:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8016]
+  mov r10, qword ptr [rbp-8000]
+  mov rcx, qword ptr [rbp-8008]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.9:
+  mov qword ptr [rbp-7968], 3
+  lea rdi, [rbp-7976]
+  mov dword ptr [rbp-10292], 7
+  movsxd rsi, dword ptr [rbp-10292]
+  mov rax, rsi
+  shr rax, 63
+  add rsi, rax
+  sar rsi, 1
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.10]
+  mov qword ptr [rbp-7984], rsi
+  mov rdi, qword ptr [rbp-7968]
+  mov rsi, qword ptr [rbp-7976]
+  cmp rdi, rsi
+  jne .Lelse.main.10
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7984]
+  mov rdx, qword ptr [rbp-7976]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.10
+.Lelse.main.10:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7984]
+  mov r10, qword ptr [rbp-7968]
+  mov rcx, qword ptr [rbp-7976]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.10:
+  mov qword ptr [rbp-7936], -2
+  lea rdi, [rbp-7944]
+  mov dword ptr [rbp-10288], -7
+  movsxd rsi, dword ptr [rbp-10288]
+  movabs rax, 6148914691236517206
+  imul rsi
+  shr rsi, 63
+  add rsi, rdx
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.11]
+  mov qword ptr [rbp-7952], rsi
+  mov rdi, qword ptr [rbp-7936]
+  mov rsi, qword ptr [rbp-7944]
+  cmp rdi, rsi
+  jne .Lelse.main.11
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7952]
+  mov rdx, qword ptr [rbp-7944]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.11
+.Lelse.main.11:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7952]
+  mov r10, qword ptr [rbp-7936]
+  mov rcx, qword ptr [rbp-7944]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.11:
+  mov qword ptr [rbp-7904], -2
+  lea rdi, [rbp-7912]
+  mov dword ptr [rbp-10284], 7
+  movsxd rsi, dword ptr [rbp-10284]
+  movabs rax, 6148914691236517206
+  imul rsi
+  shr rsi, 63
+  add rsi, rdx
+  neg rsi
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.12]
+  mov qword ptr [rbp-7920], rsi
+  mov rdi, qword ptr [rbp-7904]
+  mov rsi, qword ptr [rbp-7912]
+  cmp rdi, rsi
+  jne .Lelse.main.12
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7920]
+  mov rdx, qword ptr [rbp-7912]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.12
+.Lelse.main.12:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7920]
+  mov r10, qword ptr [rbp-7904]
+  mov rcx, qword ptr [rbp-7912]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.12:
+  mov qword ptr [rbp-7872], -1
+  lea rdi, [rbp-7880]
+  mov qword ptr [rbp-10280], -1000
+  mov rsi, qword ptr [rbp-10280]
+  movabs rax, 7367186400732675841
+  imul rsi
+  sar rdx, 8
+  shr rsi, 63
+  add rsi, rdx
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.13]
+  mov qword ptr [rbp-7888], rsi
+  mov rdi, qword ptr [rbp-7872]
+  mov rsi, qword ptr [rbp-7880]
+  cmp rdi, rsi
+  jne .Lelse.main.13
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7888]
+  mov rdx, qword ptr [rbp-7880]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.13
+.Lelse.main.13:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7888]
+  mov r10, qword ptr [rbp-7872]
+  mov rcx, qword ptr [rbp-7880]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.13:
+  mov qword ptr [rbp-7840], 7
+  mov dword ptr [rbp-10268], -7
+  movsxd rsi, dword ptr [rbp-10268]
+  neg rsi
+  mov qword ptr [rbp-7848], rsi
+  lea rsi, [rip+.L.data.main.14]
+  mov qword ptr [rbp-7856], rsi
+  mov rdi, qword ptr [rbp-7840]
+  mov rsi, qword ptr [rbp-7848]
+  cmp rdi, rsi
+  jne .Lelse.main.14
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7856]
+  mov rdx, qword ptr [rbp-7848]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.14
+.Lelse.main.14:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7856]
+  mov r10, qword ptr [rbp-7840]
+  mov rcx, qword ptr [rbp-7848]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.14:
+  mov qword ptr [rbp-7808], -125
+  lea rdi, [rbp-7816]
+  mov qword ptr [rbp-10264], -1000
+  mov rsi, qword ptr [rbp-10264]
+  mov rax, rsi
+  sar rax, 63
+  shr rax, 61
+  add rsi, rax
+  sar rsi, 3
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.15]
+  mov qword ptr [rbp-7824], rsi
+  mov rdi, qword ptr [rbp-7808]
+  mov rsi, qword ptr [rbp-7816]
+  cmp rdi, rsi
+  jne .Lelse.main.15
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7824]
+  mov rdx, qword ptr [rbp-7816]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.15
+.Lelse.main.15:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7824]
+  mov r10, qword ptr [rbp-7808]
+  mov rcx, qword ptr [rbp-7816]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.15:
+  mov qword ptr [rbp-7776], -4
+  lea rdi, [rbp-7784]
+  movabs r10, -4294967297
+  mov qword ptr [rbp-10256], r10
+  mov rsi, r10
+  mov rax, rsi
+  sar rax, 63
+  shr rax, 34
+  add rsi, rax
+  sar rsi, 30
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.16]
+  mov qword ptr [rbp-7792], rsi
+  mov rdi, qword ptr [rbp-7776]
+  mov rsi, qword ptr [rbp-7784]
+  cmp rdi, rsi
+  jne .Lelse.main.16
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7792]
+  mov rdx, qword ptr [rbp-7784]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.16
+.Lelse.main.16:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7792]
+  mov r10, qword ptr [rbp-7776]
+  mov rcx, qword ptr [rbp-7784]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.16:
+  mov qword ptr [rbp-7744], 2
+  lea rdi, [rbp-7752]
+  movabs r10, 4294967297
+  mov qword ptr [rbp-10248], r10
+  mov rsi, r10
+  movabs rax, -9223372032559808509
+  imul rsi
+  add rdx, rsi
+  sar rdx, 30
+  shr rsi, 63
+  add rsi, rdx
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.17]
+  mov qword ptr [rbp-7760], rsi
+  mov rdi, qword ptr [rbp-7744]
+  mov rsi, qword ptr [rbp-7752]
+  cmp rdi, rsi
+  jne .Lelse.main.17
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7760]
+  mov rdx, qword ptr [rbp-7752]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.17
+.Lelse.main.17:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7760]
+  mov r10, qword ptr [rbp-7744]
+  mov rcx, qword ptr [rbp-7752]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.17:
+  mov qword ptr [rbp-7712], 35
+  mov dword ptr [rbp-10236], 7
+  movsxd rsi, dword ptr [rbp-10236]
+  lea rsi, [rsi+rsi*4]
+  mov qword ptr [rbp-7720], rsi
+  lea rsi, [rip+.L.data.main.18]
+  mov qword ptr [rbp-7728], rsi
+  mov rdi, qword ptr [rbp-7712]
+  mov rsi, qword ptr [rbp-7720]
+  cmp rdi, rsi
+  jne .Lelse.main.18
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7728]
+  mov rdx, qword ptr [rbp-7720]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.18
+.Lelse.main.18:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7728]
+  mov r10, qword ptr [rbp-7712]
+  mov rcx, qword ptr [rbp-7720]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.18:
+  mov qword ptr [rbp-7680], -84
+  lea rdi, [rbp-7688]
+  mov dword ptr [rbp-10232], 7
+  movsxd rsi, dword ptr [rbp-10232]
+  lea rsi, [rsi+rsi*2]
+  shl rsi, 2
+  neg rsi
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.19]
+  mov qword ptr [rbp-7696], rsi
+  mov rdi, qword ptr [rbp-7680]
+  mov rsi, qword ptr [rbp-7688]
+  cmp rdi, rsi
+  jne .Lelse.main.19
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7696]
+  mov rdx, qword ptr [rbp-7688]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.19
+.Lelse.main.19:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7696]
+  mov r10, qword ptr [rbp-7680]
+  mov rcx, qword ptr [rbp-7688]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.19:
+  mov qword ptr [rbp-7648], -7
+  mov dword ptr [rbp-10228], 7
+  movsxd rsi, dword ptr [rbp-10228]
+  neg rsi
+  mov qword ptr [rbp-7656], rsi
+  lea rsi, [rip+.L.data.main.20]
+  mov qword ptr [rbp-7664], rsi
+  mov rdi, qword ptr [rbp-7648]
+  mov rsi, qword ptr [rbp-7656]
+  cmp rdi, rsi
+  jne .Lelse.main.20
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7664]
+  mov rdx, qword ptr [rbp-7656]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.20
+.Lelse.main.20:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7664]
+  mov r10, qword ptr [rbp-7648]
+  mov rcx, qword ptr [rbp-7656]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.20:
+  mov qword ptr [rbp-7616], 9
+  lea rdi, [rbp-7624]
+  mov dword ptr [rbp-10204], 2
+  lea rsi, [rbp-10222]
+  movsxd r10, dword ptr [rbp-10204]
+  lea r10, [r10+r10*2]
+  shl r10, 1
+  add rsi, r10
+  add rsi, 4
+  mov byte ptr [rsi], 9
+  lea r10, [rbp-10222]
+  mov qword ptr [rbp-10200], r10
+  mov rsi, r10
+  add rsi, 16
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.21]
+  mov qword ptr [rbp-7632], rsi
+  mov rdi, qword ptr [rbp-7616]
+  mov rsi, qword ptr [rbp-7624]
+  cmp rdi, rsi
+  jne .Lelse.main.21
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7632]
+  mov rdx, qword ptr [rbp-7624]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.21
+.Lelse.main.21:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7632]
+  mov r10, qword ptr [rbp-7616]
+  mov rcx, qword ptr [rbp-7624]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.21:
+  mov qword ptr [rbp-7584], 5
+  lea rdi, [rbp-7592]
+  mov dword ptr [rbp-10180], 5
+  mov dword ptr [rbp-10156], 1
+  lea r10, [rbp-10168]
+  mov qword ptr [rbp-10152], r10
+  lea rsi, [rbp-10152]
+  mov r10, qword ptr [rbp-10152]
+  movsxd r11, dword ptr [rbp-10156]
+  lea r11, [r11+r11*2]
+  shl r11, 2
+  sub r10, r11
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-10152]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.22]
+  mov qword ptr [rbp-7600], rsi
+  mov rdi, qword ptr [rbp-7584]
+  mov rsi, qword ptr [rbp-7592]
+  cmp rdi, rsi
+  jne .Lelse.main.22
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7600]
+  mov rdx, qword ptr [rbp-7592]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.22
+.Lelse.main.22:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7600]
+  mov r10, qword ptr [rbp-7584]
+  mov rcx, qword ptr [rbp-7592]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.22:
+  mov qword ptr [rbp-7552], 18
+  mov qword ptr [rbp-7560], 18
+  lea rsi, [rip+.L.data.main.23]
+  mov qword ptr [rbp-7568], rsi
+  mov rdi, qword ptr [rbp-7552]
+  mov rsi, qword ptr [rbp-7560]
+  cmp rdi, rsi
+  jne .Lelse.main.23
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7568]
+  mov rdx, qword ptr [rbp-7560]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.23
+.Lelse.main.23:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7568]
+  mov r10, qword ptr [rbp-7552]
+  mov rcx, qword ptr [rbp-7560]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.23:
+  mov qword ptr [rbp-7520], 8
+  mov dword ptr [rbp-10144], 5
+  movsxd rsi, dword ptr [rbp-10144]
+  add rsi, 3
+  mov qword ptr [rbp-7528], rsi
+  lea rsi, [rip+.L.data.main.24]
+  mov qword ptr [rbp-7536], rsi
+  mov rdi, qword ptr [rbp-7520]
+  mov rsi, qword ptr [rbp-7528]
+  cmp rdi, rsi
+  jne .Lelse.main.24
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7536]
+  mov rdx, qword ptr [rbp-7528]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.24
+.Lelse.main.24:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7536]
+  mov r10, qword ptr [rbp-7520]
+  mov rcx, qword ptr [rbp-7528]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.24:
+  mov qword ptr [rbp-7488], 6
+  mov dword ptr [rbp-10140], 5
+  movsxd rsi, dword ptr [rbp-10140]
+  add rsi, 1
+  mov qword ptr [rbp-7496], rsi
+  lea rsi, [rip+.L.data.main.25]
+  mov qword ptr [rbp-7504], rsi
+  mov rdi, qword ptr [rbp-7488]
+  mov rsi, qword ptr [rbp-7496]
+  cmp rdi, rsi
+  jne .Lelse.main.25
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7504]
+  mov rdx, qword ptr [rbp-7496]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.25
+.Lelse.main.25:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7504]
+  mov r10, qword ptr [rbp-7488]
+  mov rcx, qword ptr [rbp-7496]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.25:
+  mov qword ptr [rbp-7456], 5
+  mov dword ptr [rbp-10136], 5
+  movsxd rsi, dword ptr [rbp-10136]
+  mov qword ptr [rbp-7464], rsi
+  lea rsi, [rip+.L.data.main.26]
+  mov qword ptr [rbp-7472], rsi
+  mov rdi, qword ptr [rbp-7456]
+  mov rsi, qword ptr [rbp-7464]
+  cmp rdi, rsi
+  jne .Lelse.main.26
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7472]
+  mov rdx, qword ptr [rbp-7464]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.26
+.Lelse.main.26:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7472]
+  mov r10, qword ptr [rbp-7456]
+  mov rcx, qword ptr [rbp-7464]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.26:
+  mov qword ptr [rbp-7424], -10
+  mov qword ptr [rbp-7432], -10
+  lea rsi, [rip+.L.data.main.27]
+  mov qword ptr [rbp-7440], rsi
+  mov rdi, qword ptr [rbp-7424]
+  mov rsi, qword ptr [rbp-7432]
+  cmp rdi, rsi
+  jne .Lelse.main.27
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7440]
+  mov rdx, qword ptr [rbp-7432]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.27
+.Lelse.main.27:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7440]
+  mov r10, qword ptr [rbp-7424]
+  mov rcx, qword ptr [rbp-7432]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.27:
+  mov qword ptr [rbp-7392], 10
+  mov qword ptr [rbp-7400], 10
+  lea rsi, [rip+.L.data.main.28]
+  mov qword ptr [rbp-7408], rsi
+  mov rdi, qword ptr [rbp-7392]
+  mov rsi, qword ptr [rbp-7400]
+  cmp rdi, rsi
+  jne .Lelse.main.28
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7408]
+  mov rdx, qword ptr [rbp-7400]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.28
+.Lelse.main.28:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7408]
+  mov r10, qword ptr [rbp-7392]
+  mov rcx, qword ptr [rbp-7400]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.28:
+  mov qword ptr [rbp-7360], 10
+  mov qword ptr [rbp-7368], 10
+  lea rsi, [rip+.L.data.main.29]
+  mov qword ptr [rbp-7376], rsi
+  mov rdi, qword ptr [rbp-7360]
+  mov rsi, qword ptr [rbp-7368]
+  cmp rdi, rsi
+  jne .Lelse.main.29
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7376]
+  mov rdx, qword ptr [rbp-7368]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.29
+.Lelse.main.29:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7376]
+  mov r10, qword ptr [rbp-7360]
+  mov rcx, qword ptr [rbp-7368]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.29:
+  mov qword ptr [rbp-7328], 0
+  mov qword ptr [rbp-7336], 0
+  lea rsi, [rip+.L.data.main.30]
+  mov qword ptr [rbp-7344], rsi
+  mov rdi, qword ptr [rbp-7328]
+  mov rsi, qword ptr [rbp-7336]
+  cmp rdi, rsi
+  jne .Lelse.main.30
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7344]
+  mov rdx, qword ptr [rbp-7336]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.30
+.Lelse.main.30:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7344]
+  mov r10, qword ptr [rbp-7328]
+  mov rcx, qword ptr [rbp-7336]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.30:
+  mov qword ptr [rbp-7296], 1
+  mov qword ptr [rbp-7304], 1
+  lea rsi, [rip+.L.data.main.31]
+  mov qword ptr [rbp-7312], rsi
+  mov rdi, qword ptr [rbp-7296]
+  mov rsi, qword ptr [rbp-7304]
+  cmp rdi, rsi
+  jne .Lelse.main.31
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7312]
+  mov rdx, qword ptr [rbp-7304]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.31
+.Lelse.main.31:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7312]
+  mov r10, qword ptr [rbp-7296]
+  mov rcx, qword ptr [rbp-7304]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.31:
+  mov qword ptr [rbp-7264], 1
+  mov qword ptr [rbp-7272], 1
+  lea rsi, [rip+.L.data.main.32]
+  mov qword ptr [rbp-7280], rsi
+  mov rdi, qword ptr [rbp-7264]
+  mov rsi, qword ptr [rbp-7272]
+  cmp rdi, rsi
+  jne .Lelse.main.32
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7280]
+  mov rdx, qword ptr [rbp-7272]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.32
+.Lelse.main.32:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7280]
+  mov r10, qword ptr [rbp-7264]
+  mov rcx, qword ptr [rbp-7272]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.32:
+  mov qword ptr [rbp-7232], 0
+  mov qword ptr [rbp-7240], 0
+  lea rsi, [rip+.L.data.main.33]
+  mov qword ptr [rbp-7248], rsi
+  mov rdi, qword ptr [rbp-7232]
+  mov rsi, qword ptr [rbp-7240]
+  cmp rdi, rsi
+  jne .Lelse.main.33
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7248]
+  mov rdx, qword ptr [rbp-7240]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.33
+.Lelse.main.33:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7248]
+  mov r10, qword ptr [rbp-7232]
+  mov rcx, qword ptr [rbp-7240]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.33:
+  mov qword ptr [rbp-7200], 1
+  mov qword ptr [rbp-7208], 1
+  lea rsi, [rip+.L.data.main.34]
+  mov qword ptr [rbp-7216], rsi
+  mov rdi, qword ptr [rbp-7200]
+  mov rsi, qword ptr [rbp-7208]
+  cmp rdi, rsi
+  jne .Lelse.main.34
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7216]
+  mov rdx, qword ptr [rbp-7208]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.34
+.Lelse.main.34:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7216]
+  mov r10, qword ptr [rbp-7200]
+  mov rcx, qword ptr [rbp-7208]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.34:
+  mov qword ptr [rbp-7168], 0
+  mov qword ptr [rbp-7176], 0
+  lea rsi, [rip+.L.data.main.35]
+  mov qword ptr [rbp-7184], rsi
+  mov rdi, qword ptr [rbp-7168]
+  mov rsi, qword ptr [rbp-7176]
+  cmp rdi, rsi
+  jne .Lelse.main.35
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7184]
+  mov rdx, qword ptr [rbp-7176]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.35
+.Lelse.main.35:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7184]
+  mov r10, qword ptr [rbp-7168]
+  mov rcx, qword ptr [rbp-7176]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.35:
+  mov qword ptr [rbp-7136], 0
+  mov qword ptr [rbp-7144], 0
+  lea rsi, [rip+.L.data.main.36]
+  mov qword ptr [rbp-7152], rsi
+  mov rdi, qword ptr [rbp-7136]
+  mov rsi, qword ptr [rbp-7144]
+  cmp rdi, rsi
+  jne .Lelse.main.36
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7152]
+  mov rdx, qword ptr [rbp-7144]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.36
+.Lelse.main.36:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7152]
+  mov r10, qword ptr [rbp-7136]
+  mov rcx, qword ptr [rbp-7144]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.36:
+  mov qword ptr [rbp-7104], 1
+  mov qword ptr [rbp-7112], 1
+  lea rsi, [rip+.L.data.main.37]
+  mov qword ptr [rbp-7120], rsi
+  mov rdi, qword ptr [rbp-7104]
+  mov rsi, qword ptr [rbp-7112]
+  cmp rdi, rsi
+  jne .Lelse.main.37
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7120]
+  mov rdx, qword ptr [rbp-7112]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.37
+.Lelse.main.37:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7120]
+  mov r10, qword ptr [rbp-7104]
+  mov rcx, qword ptr [rbp-7112]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.37:
+  mov qword ptr [rbp-7072], 1
+  mov qword ptr [rbp-7080], 1
+  lea rsi, [rip+.L.data.main.38]
+  mov qword ptr [rbp-7088], rsi
+  mov rdi, qword ptr [rbp-7072]
+  mov rsi, qword ptr [rbp-7080]
+  cmp rdi, rsi
+  jne .Lelse.main.38
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7088]
+  mov rdx, qword ptr [rbp-7080]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.38
+.Lelse.main.38:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7088]
+  mov r10, qword ptr [rbp-7072]
+  mov rcx, qword ptr [rbp-7080]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.38:
+  mov qword ptr [rbp-7040], 0
+  mov qword ptr [rbp-7048], 0
+  lea rsi, [rip+.L.data.main.39]
+  mov qword ptr [rbp-7056], rsi
+  mov rdi, qword ptr [rbp-7040]
+  mov rsi, qword ptr [rbp-7048]
+  cmp rdi, rsi
+  jne .Lelse.main.39
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7056]
+  mov rdx, qword ptr [rbp-7048]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.39
+.Lelse.main.39:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7056]
+  mov r10, qword ptr [rbp-7040]
+  mov rcx, qword ptr [rbp-7048]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.39:
+  mov qword ptr [rbp-7008], 1
+  mov qword ptr [rbp-7016], 1
+  lea rsi, [rip+.L.data.main.40]
+  mov qword ptr [rbp-7024], rsi
+  mov rdi, qword ptr [rbp-7008]
+  mov rsi, qword ptr [rbp-7016]
+  cmp rdi, rsi
+  jne .Lelse.main.40
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-7024]
+  mov rdx, qword ptr [rbp-7016]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.40
+.Lelse.main.40:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-7024]
+  mov r10, qword ptr [rbp-7008]
+  mov rcx, qword ptr [rbp-7016]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.40:
+  mov qword ptr [rbp-6976], 0
+  mov qword ptr [rbp-6984], 0
+  lea rsi, [rip+.L.data.main.41]
+  mov qword ptr [rbp-6992], rsi
+  mov rdi, qword ptr [rbp-6976]
+  mov rsi, qword ptr [rbp-6984]
+  cmp rdi, rsi
+  jne .Lelse.main.41
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6992]
+  mov rdx, qword ptr [rbp-6984]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.41
+.Lelse.main.41:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6992]
+  mov r10, qword ptr [rbp-6976]
+  mov rcx, qword ptr [rbp-6984]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.41:
+  mov qword ptr [rbp-6944], 0
+  mov qword ptr [rbp-6952], 0
+  lea rsi, [rip+.L.data.main.42]
+  mov qword ptr [rbp-6960], rsi
+  mov rdi, qword ptr [rbp-6944]
+  mov rsi, qword ptr [rbp-6952]
+  cmp rdi, rsi
+  jne .Lelse.main.42
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6960]
+  mov rdx, qword ptr [rbp-6952]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.42
+.Lelse.main.42:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6960]
+  mov r10, qword ptr [rbp-6944]
+  mov rcx, qword ptr [rbp-6952]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.42:
+  mov qword ptr [rbp-6912], 1
+  mov qword ptr [rbp-6920], 1
+  lea rsi, [rip+.L.data.main.43]
+  mov qword ptr [rbp-6928], rsi
+  mov rdi, qword ptr [rbp-6912]
+  mov rsi, qword ptr [rbp-6920]
+  cmp rdi, rsi
+  jne .Lelse.main.43
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6928]
+  mov rdx, qword ptr [rbp-6920]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.43
+.Lelse.main.43:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6928]
+  mov r10, qword ptr [rbp-6912]
+  mov rcx, qword ptr [rbp-6920]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.43:
+  mov qword ptr [rbp-6880], 1
+  mov qword ptr [rbp-6888], 1
+  lea rsi, [rip+.L.data.main.44]
+  mov qword ptr [rbp-6896], rsi
+  mov rdi, qword ptr [rbp-6880]
+  mov rsi, qword ptr [rbp-6888]
+  cmp rdi, rsi
+  jne .Lelse.main.44
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6896]
+  mov rdx, qword ptr [rbp-6888]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.44
+.Lelse.main.44:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6896]
+  mov r10, qword ptr [rbp-6880]
+  mov rcx, qword ptr [rbp-6888]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.44:
+  mov qword ptr [rbp-6848], 0
+  mov qword ptr [rbp-6856], 0
+  lea rsi, [rip+.L.data.main.45]
+  mov qword ptr [rbp-6864], rsi
+  mov rdi, qword ptr [rbp-6848]
+  mov rsi, qword ptr [rbp-6856]
+  cmp rdi, rsi
+  jne .Lelse.main.45
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6864]
+  mov rdx, qword ptr [rbp-6856]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.45
+.Lelse.main.45:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6864]
+  mov r10, qword ptr [rbp-6848]
+  mov rcx, qword ptr [rbp-6856]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.45:
+  mov qword ptr [rbp-6816], 3
+  mov dword ptr [rbp-10132], 3
+  movsxd rsi, dword ptr [rbp-10132]
+  mov qword ptr [rbp-6824], rsi
+  lea rsi, [rip+.L.data.main.46]
+  mov qword ptr [rbp-6832], rsi
+  mov rdi, qword ptr [rbp-6816]
+  mov rsi, qword ptr [rbp-6824]
+  cmp rdi, rsi
+  jne .Lelse.main.46
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6832]
+  mov rdx, qword ptr [rbp-6824]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.46
+.Lelse.main.46:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6832]
+  mov r10, qword ptr [rbp-6816]
+  mov rcx, qword ptr [rbp-6824]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.46:
+  mov qword ptr [rbp-6784], 8
+  lea rdi, [rbp-6792]
+  mov dword ptr [rbp-10128], 3
+  mov dword ptr [rbp-10124], 5
+  movsxd rsi, dword ptr [rbp-10128]
+  movsxd r10, dword ptr [rbp-10124]
+  add rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.47]
+  mov qword ptr [rbp-6800], rsi
+  mov rdi, qword ptr [rbp-6784]
+  mov rsi, qword ptr [rbp-6792]
+  cmp rdi, rsi
+  jne .Lelse.main.47
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6800]
+  mov rdx, qword ptr [rbp-6792]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.47
+.Lelse.main.47:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6800]
+  mov r10, qword ptr [rbp-6784]
+  mov rcx, qword ptr [rbp-6792]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.47:
+  mov qword ptr [rbp-6752], 3
+  mov dword ptr [rbp-10120], 3
+  movsxd rsi, dword ptr [rbp-10120]
+  mov qword ptr [rbp-6760], rsi
+  lea rsi, [rip+.L.data.main.48]
+  mov qword ptr [rbp-6768], rsi
+  mov rdi, qword ptr [rbp-6752]
+  mov rsi, qword ptr [rbp-6760]
+  cmp rdi, rsi
+  jne .Lelse.main.48
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6768]
+  mov rdx, qword ptr [rbp-6760]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.48
+.Lelse.main.48:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6768]
+  mov r10, qword ptr [rbp-6752]
+  mov rcx, qword ptr [rbp-6760]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.48:
+  mov qword ptr [rbp-6720], 8
+  lea rdi, [rbp-6728]
+  mov dword ptr [rbp-10116], 3
+  mov dword ptr [rbp-10112], 5
+  movsxd rsi, dword ptr [rbp-10116]
+  movsxd r10, dword ptr [rbp-10112]
+  add rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.49]
+  mov qword ptr [rbp-6736], rsi
+  mov rdi, qword ptr [rbp-6720]
+  mov rsi, qword ptr [rbp-6728]
+  cmp rdi, rsi
+  jne .Lelse.main.49
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6736]
+  mov rdx, qword ptr [rbp-6728]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.49
+.Lelse.main.49:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6736]
+  mov r10, qword ptr [rbp-6720]
+  mov rcx, qword ptr [rbp-6728]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.49:
+  mov qword ptr [rbp-6688], 3
+  mov dword ptr [rbp-10108], 3
+  movsxd rsi, dword ptr [rbp-10108]
+  mov qword ptr [rbp-6696], rsi
+  lea rsi, [rip+.L.data.main.50]
+  mov qword ptr [rbp-6704], rsi
+  mov rdi, qword ptr [rbp-6688]
+  mov rsi, qword ptr [rbp-6696]
+  cmp rdi, rsi
+  jne .Lelse.main.50
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6704]
+  mov rdx, qword ptr [rbp-6696]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.50
+.Lelse.main.50:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6704]
+  mov r10, qword ptr [rbp-6688]
+  mov rcx, qword ptr [rbp-6696]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.50:
+  mov qword ptr [rbp-6656], 8
+  lea rdi, [rbp-6664]
+  mov dword ptr [rbp-10104], 3
+  mov dword ptr [rbp-10100], 5
+  movsxd rsi, dword ptr [rbp-10104]
+  movsxd r10, dword ptr [rbp-10100]
+  add rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.51]
+  mov qword ptr [rbp-6672], rsi
+  mov rdi, qword ptr [rbp-6656]
+  mov rsi, qword ptr [rbp-6664]
+  cmp rdi, rsi
+  jne .Lelse.main.51
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6672]
+  mov rdx, qword ptr [rbp-6664]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.51
+.Lelse.main.51:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6672]
+  mov r10, qword ptr [rbp-6656]
+  mov rcx, qword ptr [rbp-6664]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.51:
+  mov qword ptr [rbp-6616], 3
+  lea rdi, [rbp-6624]
+  mov qword ptr [rbp-6640], 3
+.Ljoin.main.0:
+  mov rsi, qword ptr [rbp-6640]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.52]
+  mov qword ptr [rbp-6632], rsi
+  mov rdi, qword ptr [rbp-6616]
+  mov rsi, qword ptr [rbp-6624]
+  cmp rdi, rsi
+  jne .Lelse.main.52
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6632]
+  mov rdx, qword ptr [rbp-6624]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.52
+.Lelse.main.52:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6632]
+  mov r10, qword ptr [rbp-6616]
+  mov rcx, qword ptr [rbp-6624]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.52:
+  mov qword ptr [rbp-6584], 3
+  mov dword ptr [rbp-10096], 0
+  mov dword ptr [rbp-10096], 3
+  movsxd rsi, dword ptr [rbp-10096]
+  mov qword ptr [rbp-6592], rsi
+  lea rsi, [rip+.L.data.main.53]
+  mov qword ptr [rbp-6600], rsi
+  mov rdi, qword ptr [rbp-6584]
+  mov rsi, qword ptr [rbp-6592]
+  cmp rdi, rsi
+  jne .Lelse.main.53
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6600]
+  mov rdx, qword ptr [rbp-6592]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.53
+.Lelse.main.53:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6600]
+  mov r10, qword ptr [rbp-6584]
+  mov rcx, qword ptr [rbp-6592]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.53:
+  mov qword ptr [rbp-6552], 3
+  mov dword ptr [rbp-10092], 0
+  mov dword ptr [rbp-10092], 3
+  movsxd rsi, dword ptr [rbp-10092]
+  mov qword ptr [rbp-6560], rsi
+  lea rsi, [rip+.L.data.main.54]
+  mov qword ptr [rbp-6568], rsi
+  mov rdi, qword ptr [rbp-6552]
+  mov rsi, qword ptr [rbp-6560]
+  cmp rdi, rsi
+  jne .Lelse.main.54
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6568]
+  mov rdx, qword ptr [rbp-6560]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.54
+.Lelse.main.54:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6568]
+  mov r10, qword ptr [rbp-6552]
+  mov rcx, qword ptr [rbp-6560]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.54:
+  mov qword ptr [rbp-6520], 2
+  mov dword ptr [rbp-10088], 0
+  mov dword ptr [rbp-10088], 2
+  movsxd rsi, dword ptr [rbp-10088]
+  mov qword ptr [rbp-6528], rsi
+  lea rsi, [rip+.L.data.main.55]
+  mov qword ptr [rbp-6536], rsi
+  mov rdi, qword ptr [rbp-6520]
+  mov rsi, qword ptr [rbp-6528]
+  cmp rdi, rsi
+  jne .Lelse.main.55
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6536]
+  mov rdx, qword ptr [rbp-6528]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.55
+.Lelse.main.55:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6536]
+  mov r10, qword ptr [rbp-6520]
+  mov rcx, qword ptr [rbp-6528]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.55:
+  mov qword ptr [rbp-6488], 2
+  mov dword ptr [rbp-10084], 0
+  mov dword ptr [rbp-10084], 2
+  movsxd rsi, dword ptr [rbp-10084]
+  mov qword ptr [rbp-6496], rsi
+  lea rsi, [rip+.L.data.main.56]
+  mov qword ptr [rbp-6504], rsi
+  mov rdi, qword ptr [rbp-6488]
+  mov rsi, qword ptr [rbp-6496]
+  cmp rdi, rsi
+  jne .Lelse.main.56
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6504]
+  mov rdx, qword ptr [rbp-6496]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.56
+.Lelse.main.56:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6504]
+  mov r10, qword ptr [rbp-6488]
+  mov rcx, qword ptr [rbp-6496]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.56:
+  mov qword ptr [rbp-6456], 3
+  lea rdi, [rbp-6464]
+  mov dword ptr [rbp-10080], 5
+  movsxd rsi, dword ptr [rbp-10080]
+  cmp rsi, 3
+  jge .Lelse.main.57
+  mov dword ptr [rbp-10080], 2
+  jmp .Lend.main.57
+.Lelse.main.57:
+  mov dword ptr [rbp-10080], 3
+.Lend.main.57:
+  movsxd rsi, dword ptr [rbp-10080]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.57]
+  mov qword ptr [rbp-6472], rsi
+  mov rdi, qword ptr [rbp-6456]
+  mov rsi, qword ptr [rbp-6464]
+  cmp rdi, rsi
+  jne .Lelse.main.58
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6472]
+  mov rdx, qword ptr [rbp-6464]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.58
+.Lelse.main.58:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6472]
+  mov r10, qword ptr [rbp-6456]
+  mov rcx, qword ptr [rbp-6464]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.58:
+  mov qword ptr [rbp-6424], 2
+  lea rdi, [rbp-6432]
+  mov dword ptr [rbp-10076], 5
+  movsxd rsi, dword ptr [rbp-10076]
+  cmp rsi, 3
+  jle .Lelse.main.59
+  mov dword ptr [rbp-10076], 2
+  jmp .Lend.main.59
+.Lelse.main.59:
+  mov dword ptr [rbp-10076], 3
+.Lend.main.59:
+  movsxd rsi, dword ptr [rbp-10076]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.58]
+  mov qword ptr [rbp-6440], rsi
+  mov rdi, qword ptr [rbp-6424]
+  mov rsi, qword ptr [rbp-6432]
+  cmp rdi, rsi
+  jne .Lelse.main.60
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6440]
+  mov rdx, qword ptr [rbp-6432]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.60
+.Lelse.main.60:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6440]
+  mov r10, qword ptr [rbp-6424]
+  mov rcx, qword ptr [rbp-6432]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.60:
+  mov qword ptr [rbp-6392], 2
+  lea rdi, [rbp-6400]
+  mov dword ptr [rbp-10072], 5
+  movsxd rsi, dword ptr [rbp-10072]
+  cmp rsi, 0
+  jle .Lelse.main.61
+  mov dword ptr [rbp-10072], 2
+  jmp .Lend.main.61
+.Lelse.main.61:
+  mov dword ptr [rbp-10072], 3
+.Lend.main.61:
+  movsxd rsi, dword ptr [rbp-10072]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.59]
+  mov qword ptr [rbp-6408], rsi
+  mov rdi, qword ptr [rbp-6392]
+  mov rsi, qword ptr [rbp-6400]
+  cmp rdi, rsi
+  jne .Lelse.main.62
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6408]
+  mov rdx, qword ptr [rbp-6400]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.62
+.Lelse.main.62:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6408]
+  mov r10, qword ptr [rbp-6392]
+  mov rcx, qword ptr [rbp-6400]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.62:
+  mov qword ptr [rbp-6360], 3
+  lea rdi, [rbp-6368]
+  mov dword ptr [rbp-10068], 5
+  movsxd rsi, dword ptr [rbp-10068]
+  add rsi, 1
+  cmp rsi, 5
+  jg .Lelse.main.63
+  mov dword ptr [rbp-10068], 2
+  jmp .Lend.main.63
+.Lelse.main.63:
+  mov dword ptr [rbp-10068], 3
+.Lend.main.63:
+  movsxd rsi, dword ptr [rbp-10068]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.60]
+  mov qword ptr [rbp-6376], rsi
+  mov rdi, qword ptr [rbp-6360]
+  mov rsi, qword ptr [rbp-6368]
+  cmp rdi, rsi
+  jne .Lelse.main.64
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6376]
+  mov rdx, qword ptr [rbp-6368]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.64
+.Lelse.main.64:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6376]
+  mov r10, qword ptr [rbp-6360]
+  mov rcx, qword ptr [rbp-6368]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.64:
+  mov qword ptr [rbp-6328], 2
+  lea rdi, [rbp-6336]
+  mov dword ptr [rbp-10064], 5
+  movsxd rsi, dword ptr [rbp-10064]
+  cmp rsi, 3
+  jl .Lelse.main.65
+  mov dword ptr [rbp-10064], 2
+  jmp .Lend.main.65
+.Lelse.main.65:
+  mov dword ptr [rbp-10064], 3
+.Lend.main.65:
+  movsxd rsi, dword ptr [rbp-10064]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.61]
+  mov qword ptr [rbp-6344], rsi
+  mov rdi, qword ptr [rbp-6328]
+  mov rsi, qword ptr [rbp-6336]
+  cmp rdi, rsi
+  jne .Lelse.main.66
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6344]
+  mov rdx, qword ptr [rbp-6336]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.66
+.Lelse.main.66:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6344]
+  mov r10, qword ptr [rbp-6328]
+  mov rcx, qword ptr [rbp-6336]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.66:
+  mov qword ptr [rbp-6296], 3
+  lea rdi, [rbp-6304]
+  mov dword ptr [rbp-10060], 5
+  movsxd rsi, dword ptr [rbp-10060]
+  cmp rsi, 5
+  je .Lelse.main.67
+  mov dword ptr [rbp-10060], 2
+  jmp .Lend.main.67
+.Lelse.main.67:
+  mov dword ptr [rbp-10060], 3
+.Lend.main.67:
+  movsxd rsi, dword ptr [rbp-10060]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.62]
+  mov qword ptr [rbp-6312], rsi
+  mov rdi, qword ptr [rbp-6296]
+  mov rsi, qword ptr [rbp-6304]
+  cmp rdi, rsi
+  jne .Lelse.main.68
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6312]
+  mov rdx, qword ptr [rbp-6304]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.68
+.Lelse.main.68:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6312]
+  mov r10, qword ptr [rbp-6296]
+  mov rcx, qword ptr [rbp-6304]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.68:
+  mov qword ptr [rbp-6264], 2
+  lea rdi, [rbp-6272]
+  mov dword ptr [rbp-10056], 5
+  movsxd rsi, dword ptr [rbp-10056]
+  cmp rsi, 5
+  jne .Lelse.main.69
+  mov dword ptr [rbp-10056], 2
+  jmp .Lend.main.69
+.Lelse.main.69:
+  mov dword ptr [rbp-10056], 3
+.Lend.main.69:
+  movsxd rsi, dword ptr [rbp-10056]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.63]
+  mov qword ptr [rbp-6280], rsi
+  mov rdi, qword ptr [rbp-6264]
+  mov rsi, qword ptr [rbp-6272]
+  cmp rdi, rsi
+  jne .Lelse.main.70
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6280]
+  mov rdx, qword ptr [rbp-6272]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.70
+.Lelse.main.70:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6280]
+  mov r10, qword ptr [rbp-6264]
+  mov rcx, qword ptr [rbp-6272]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.70:
+  mov qword ptr [rbp-6232], 2
+  lea rdi, [rbp-6240]
+  mov dword ptr [rbp-10052], 5
+  mov dword ptr [rbp-10048], 1
+  movsxd rsi, dword ptr [rbp-10052]
+  sub rsi, 5
+  movsxd r10, dword ptr [rbp-10048]
+  sub r10, 1
+  cmp rsi, r10
+  jne .Lelse.main.71
+  mov dword ptr [rbp-10052], 2
+  jmp .Lend.main.71
+.Lelse.main.71:
+  mov dword ptr [rbp-10052], 3
+.Lend.main.71:
+  movsxd rsi, dword ptr [rbp-10052]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.64]
+  mov qword ptr [rbp-6248], rsi
+  mov rdi, qword ptr [rbp-6232]
+  mov rsi, qword ptr [rbp-6240]
+  cmp rdi, rsi
+  jne .Lelse.main.72
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6248]
+  mov rdx, qword ptr [rbp-6240]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.72
+.Lelse.main.72:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6248]
+  mov r10, qword ptr [rbp-6232]
+  mov rcx, qword ptr [rbp-6240]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.72:
+  mov qword ptr [rbp-6200], 2
+  lea rdi, [rbp-6208]
+  mov dword ptr [rbp-10044], 5
+  lea r10, [rbp-10044]
+  mov qword ptr [rbp-10040], r10
+  mov rsi, r10
+  cmp rsi, 0
+  je .Lelse.main.73
+  mov dword ptr [rbp-10044], 2
+  jmp .Lend.main.73
+.Lelse.main.73:
+  mov dword ptr [rbp-10044], 3
+.Lend.main.73:
+  movsxd rsi, dword ptr [rbp-10044]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.65]
+  mov qword ptr [rbp-6216], rsi
+  mov rdi, qword ptr [rbp-6200]
+  mov rsi, qword ptr [rbp-6208]
+  cmp rdi, rsi
+  jne .Lelse.main.74
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6216]
+  mov rdx, qword ptr [rbp-6208]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.74
+.Lelse.main.74:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6216]
+  mov r10, qword ptr [rbp-6200]
+  mov rcx, qword ptr [rbp-6208]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.74:
+  mov qword ptr [rbp-6168], 10
+  lea rdi, [rbp-6176]
+  mov dword ptr [rbp-10028], 0
+  movsxd rsi, dword ptr [rbp-10028]
+  cmp rsi, 10
+  jge .Lend.main.75
+.align 16
+.Lbegin.main.75:
+  movsxd r10, dword ptr [rbp-10028]
+  add r10, 1
+  mov dword ptr [rbp-10028], r10d
+  movsxd rsi, r10d
+  cmp rsi, 10
+  jl .Lbegin.main.75
+.Lend.main.75:
+  movsxd rsi, dword ptr [rbp-10028]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.66]
+  mov qword ptr [rbp-6184], rsi
+  mov rdi, qword ptr [rbp-6168]
+  mov rsi, qword ptr [rbp-6176]
+  cmp rdi, rsi
+  jne .Lelse.main.76
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6184]
+  mov rdx, qword ptr [rbp-6176]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.76
+.Lelse.main.76:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6184]
+  mov r10, qword ptr [rbp-6168]
+  mov rcx, qword ptr [rbp-6176]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.76:
+  mov qword ptr [rbp-6136], 10
+  lea rdi, [rbp-6144]
+  mov dword ptr [rbp-10024], 0
+  movsxd rsi, dword ptr [rbp-10024]
+  cmp rsi, 10
+  jge .Lend.main.77
+.align 16
+.Lbegin.main.77:
+  movsxd r10, dword ptr [rbp-10024]
+  add r10, 1
+  mov dword ptr [rbp-10024], r10d
+  movsxd rsi, r10d
+  cmp rsi, 10
+  jl .Lbegin.main.77
+.Lend.main.77:
+  movsxd rsi, dword ptr [rbp-10024]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.67]
+  mov qword ptr [rbp-6152], rsi
+  mov rdi, qword ptr [rbp-6136]
+  mov rsi, qword ptr [rbp-6144]
+  cmp rdi, rsi
+  jne .Lelse.main.78
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6152]
+  mov rdx, qword ptr [rbp-6144]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.78
+.Lelse.main.78:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6152]
+  mov r10, qword ptr [rbp-6136]
+  mov rcx, qword ptr [rbp-6144]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.78:
+  mov qword ptr [rbp-6104], 1
+  lea rdi, [rbp-6112]
+  mov dword ptr [rbp-10020], 5
+  movsxd rsi, dword ptr [rbp-10020]
+  cmp rsi, 5
+  setge al
+  movzx rsi, al
+  cmp rsi, 1
+  sete al
+  movzx rsi, al
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.68]
+  mov qword ptr [rbp-6120], rsi
+  mov rdi, qword ptr [rbp-6104]
+  mov rsi, qword ptr [rbp-6112]
+  cmp rdi, rsi
+  jne .Lelse.main.79
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6120]
+  mov rdx, qword ptr [rbp-6112]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.79
+.Lelse.main.79:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6120]
+  mov r10, qword ptr [rbp-6104]
+  mov rcx, qword ptr [rbp-6112]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.79:
+  mov qword ptr [rbp-6072], 3
+  mov qword ptr [rbp-6080], 3
+  lea rsi, [rip+.L.data.main.69]
+  mov qword ptr [rbp-6088], rsi
+  mov rdi, qword ptr [rbp-6072]
+  mov rsi, qword ptr [rbp-6080]
+  cmp rdi, rsi
+  jne .Lelse.main.80
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6088]
+  mov rdx, qword ptr [rbp-6080]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.80
+.Lelse.main.80:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6088]
+  mov r10, qword ptr [rbp-6072]
+  mov rcx, qword ptr [rbp-6080]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.80:
+  mov qword ptr [rbp-6040], 10
+  lea rdi, [rbp-6048]
+  mov dword ptr [rbp-10016], 0
+  mov dword ptr [rbp-10016], 0
+  movsxd rsi, dword ptr [rbp-10016]
+  cmp rsi, 10
+  jge .Lend.main.81
+.align 16
+.Lbegin.main.81:
+  movsxd r10, dword ptr [rbp-10016]
+  add r10, 1
+  mov dword ptr [rbp-10016], r10d
+  movsxd rsi, r10d
+  cmp rsi, 10
+  jl .Lbegin.main.81
+.Lend.main.81:
+  movsxd rsi, dword ptr [rbp-10016]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.70]
+  mov qword ptr [rbp-6056], rsi
+  mov rdi, qword ptr [rbp-6040]
+  mov rsi, qword ptr [rbp-6048]
+  cmp rdi, rsi
+  jne .Lelse.main.82
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6056]
+  mov rdx, qword ptr [rbp-6048]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.82
+.Lelse.main.82:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6056]
+  mov r10, qword ptr [rbp-6040]
+  mov rcx, qword ptr [rbp-6048]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.82:
+  mov qword ptr [rbp-6008], 55
+  lea rdi, [rbp-6016]
+  mov dword ptr [rbp-10012], 0
+  mov dword ptr [rbp-10008], 0
+  movsxd rsi, dword ptr [rbp-10012]
+  cmp rsi, 10
+  jg .Lend.main.83
+.align 16
+.Lbegin.main.83:
+  movsxd r10, dword ptr [rbp-10012]
+  movsxd r11, dword ptr [rbp-10008]
+  add r10, r11
+  mov dword ptr [rbp-10008], r10d
+  movsxd r10, dword ptr [rbp-10012]
+  add r10, 1
+  mov dword ptr [rbp-10012], r10d
+  movsxd rsi, r10d
+  cmp rsi, 10
+  jle .Lbegin.main.83
+.Lend.main.83:
+  movsxd rsi, dword ptr [rbp-10008]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.71]
+  mov qword ptr [rbp-6024], rsi
+  mov rdi, qword ptr [rbp-6008]
+  mov rsi, qword ptr [rbp-6016]
+  cmp rdi, rsi
+  jne .Lelse.main.84
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-6024]
+  mov rdx, qword ptr [rbp-6016]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.84
+.Lelse.main.84:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-6024]
+  mov r10, qword ptr [rbp-6008]
+  mov rcx, qword ptr [rbp-6016]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.84:
+  mov qword ptr [rbp-5976], 55
+  lea rdi, [rbp-5984]
+  mov dword ptr [rbp-10004], 0
+  mov dword ptr [rbp-10000], 0
+  mov dword ptr [rbp-10004], 0
+  movsxd rsi, dword ptr [rbp-10004]
+  cmp rsi, 10
+  jg .Lend.main.85
+.align 16
+.Lbegin.main.85:
+  movsxd r10, dword ptr [rbp-10004]
+  movsxd r11, dword ptr [rbp-10000]
+  add r10, r11
+  mov dword ptr [rbp-10000], r10d
+  movsxd r10, dword ptr [rbp-10004]
+  add r10, 1
+  mov dword ptr [rbp-10004], r10d
+  movsxd rsi, r10d
+  cmp rsi, 10
+  jle .Lbegin.main.85
+.Lend.main.85:
+  movsxd rsi, dword ptr [rbp-10000]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.72]
+  mov qword ptr [rbp-5992], rsi
+  mov rdi, qword ptr [rbp-5976]
+  mov rsi, qword ptr [rbp-5984]
+  cmp rdi, rsi
+  jne .Lelse.main.86
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5992]
+  mov rdx, qword ptr [rbp-5984]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.86
+.Lelse.main.86:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5992]
+  mov r10, qword ptr [rbp-5976]
+  mov rcx, qword ptr [rbp-5984]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.86:
+  mov qword ptr [rbp-5928], 8
+  lea rdi, [rbp-5936]
+  mov dword ptr [rbp-5956], 3
+  mov dword ptr [rbp-5960], 5
+  movsxd r10, dword ptr [rbp-5956]
+  movsxd r11, dword ptr [rbp-5960]
+  add r10, r11
+  mov qword ptr [rbp-5952], r10
+  mov rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.73]
+  mov qword ptr [rbp-5944], rsi
+  mov rdi, qword ptr [rbp-5928]
+  mov rsi, qword ptr [rbp-5936]
+  cmp rdi, rsi
+  jne .Lelse.main.87
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5944]
+  mov rdx, qword ptr [rbp-5936]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.87
+.Lelse.main.87:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5944]
+  mov r10, qword ptr [rbp-5928]
+  mov rcx, qword ptr [rbp-5936]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.87:
+  mov qword ptr [rbp-5880], 2
+  lea rdi, [rbp-5888]
+  mov dword ptr [rbp-5908], 5
+  mov dword ptr [rbp-5912], 3
+  movsxd r10, dword ptr [rbp-5908]
+  movsxd r11, dword ptr [rbp-5912]
+  sub r10, r11
+  mov qword ptr [rbp-5904], r10
+  mov rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.74]
+  mov qword ptr [rbp-5896], rsi
+  mov rdi, qword ptr [rbp-5880]
+  mov rsi, qword ptr [rbp-5888]
+  cmp rdi, rsi
+  jne .Lelse.main.88
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5896]
+  mov rdx, qword ptr [rbp-5888]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.88
+.Lelse.main.88:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5896]
+  mov r10, qword ptr [rbp-5880]
+  mov rcx, qword ptr [rbp-5888]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.88:
+  mov qword ptr [rbp-5816], 21
+  lea rdi, [rbp-5824]
+  mov dword ptr [rbp-5844], 1
+  mov dword ptr [rbp-5848], 2
+  mov dword ptr [rbp-5852], 3
+  mov dword ptr [rbp-5856], 4
+  mov dword ptr [rbp-5860], 5
+  mov dword ptr [rbp-5864], 6
+  lea rsi, [rbp-5840]
+  movsxd r10, dword ptr [rbp-5844]
+  movsxd r11, dword ptr [rbp-5848]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5852]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5856]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5860]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5864]
+  add r10, r11
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-5840]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.75]
+  mov qword ptr [rbp-5832], rsi
+  mov rdi, qword ptr [rbp-5816]
+  mov rsi, qword ptr [rbp-5824]
+  cmp rdi, rsi
+  jne .Lelse.main.89
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5832]
+  mov rdx, qword ptr [rbp-5824]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.89
+.Lelse.main.89:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5832]
+  mov r10, qword ptr [rbp-5816]
+  mov rcx, qword ptr [rbp-5824]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.89:
+  mov qword ptr [rbp-5768], 55
+  lea rdi, [rbp-5776]
+  mov dword ptr [rbp-5796], 9
+  movsxd rsi, dword ptr [rbp-5796]
+  cmp rsi, 1
+  jg .Lend.main.90
+  mov qword ptr [rbp-5792], 1
+  jmp .Ljoin.main.1
+.Lend.main.90:
+  lea rsi, [rbp-5792]
+  push rdi
+  push rsi
+  movsxd rdi, dword ptr [rbp-5796]
+  sub rdi, 1
+  call fib
+  pop rsi
+  pop rdi
+  mov r10, rax
+  push rdi
+  push rsi
+  push r10
+  movsxd rdi, dword ptr [rbp-5796]
+  sub rdi, 2
+  sub rsp, 8
+  call fib
+  add rsp, 8
+  pop r10
+  pop rsi
+  pop rdi
+  mov r11, rax
+  add r10, r11
+  mov qword ptr [rsi], r10
+.Ljoin.main.1:
+  mov rsi, qword ptr [rbp-5792]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.76]
+  mov qword ptr [rbp-5784], rsi
+  mov rdi, qword ptr [rbp-5768]
+  mov rsi, qword ptr [rbp-5776]
+  cmp rdi, rsi
+  jne .Lelse.main.91
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5784]
+  mov rdx, qword ptr [rbp-5776]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.91
+.Lelse.main.91:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5784]
+  mov r10, qword ptr [rbp-5768]
+  mov rcx, qword ptr [rbp-5776]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.91:
+  mov qword ptr [rbp-5712], 0
+  lea rdi, [rbp-5720]
+  mov dword ptr [rbp-5740], -3
+  mov dword ptr [rbp-5744], 0
+  mov dword ptr [rbp-5748], 10
+  movsxd rsi, dword ptr [rbp-5740]
+  movsxd r10, dword ptr [rbp-5744]
+  cmp rsi, r10
+  jge .Lend.main.92
+  movsxd r10, dword ptr [rbp-5744]
+  mov qword ptr [rbp-5736], r10
+  jmp .Ljoin.main.2
+.Lend.main.92:
+  movsxd rsi, dword ptr [rbp-5748]
+  movsxd r10, dword ptr [rbp-5740]
+  cmp rsi, r10
+  jge .Lend.main.93
+  movsxd r10, dword ptr [rbp-5748]
+  mov qword ptr [rbp-5736], r10
+  jmp .Ljoin.main.2
+.Lend.main.93:
+  movsxd r10, dword ptr [rbp-5740]
+  mov qword ptr [rbp-5736], r10
+.Ljoin.main.2:
+  mov rsi, qword ptr [rbp-5736]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.77]
+  mov qword ptr [rbp-5728], rsi
+  mov rdi, qword ptr [rbp-5712]
+  mov rsi, qword ptr [rbp-5720]
+  cmp rdi, rsi
+  jne .Lelse.main.94
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5728]
+  mov rdx, qword ptr [rbp-5720]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.94
+.Lelse.main.94:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5728]
+  mov r10, qword ptr [rbp-5712]
+  mov rcx, qword ptr [rbp-5720]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.94:
+  mov qword ptr [rbp-5656], 10
+  lea rdi, [rbp-5664]
+  mov dword ptr [rbp-5684], 12
+  mov dword ptr [rbp-5688], 0
+  mov dword ptr [rbp-5692], 10
+  movsxd rsi, dword ptr [rbp-5684]
+  movsxd r10, dword ptr [rbp-5688]
+  cmp rsi, r10
+  jge .Lend.main.95
+  movsxd r10, dword ptr [rbp-5688]
+  mov qword ptr [rbp-5680], r10
+  jmp .Ljoin.main.3
+.Lend.main.95:
+  movsxd rsi, dword ptr [rbp-5692]
+  movsxd r10, dword ptr [rbp-5684]
+  cmp rsi, r10
+  jge .Lend.main.96
+  movsxd r10, dword ptr [rbp-5692]
+  mov qword ptr [rbp-5680], r10
+  jmp .Ljoin.main.3
+.Lend.main.96:
+  movsxd r10, dword ptr [rbp-5684]
+  mov qword ptr [rbp-5680], r10
+.Ljoin.main.3:
+  mov rsi, qword ptr [rbp-5680]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.78]
+  mov qword ptr [rbp-5672], rsi
+  mov rdi, qword ptr [rbp-5656]
+  mov rsi, qword ptr [rbp-5664]
+  cmp rdi, rsi
+  jne .Lelse.main.97
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5672]
+  mov rdx, qword ptr [rbp-5664]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.97
+.Lelse.main.97:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5672]
+  mov r10, qword ptr [rbp-5656]
+  mov rcx, qword ptr [rbp-5664]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.97:
+  mov qword ptr [rbp-5600], 4
+  lea rdi, [rbp-5608]
+  mov dword ptr [rbp-5628], 4
+  mov dword ptr [rbp-5632], 0
+  mov dword ptr [rbp-5636], 10
+  movsxd rsi, dword ptr [rbp-5628]
+  movsxd r10, dword ptr [rbp-5632]
+  cmp rsi, r10
+  jge .Lend.main.98
+  movsxd r10, dword ptr [rbp-5632]
+  mov qword ptr [rbp-5624], r10
+  jmp .Ljoin.main.4
+.Lend.main.98:
+  movsxd rsi, dword ptr [rbp-5636]
+  movsxd r10, dword ptr [rbp-5628]
+  cmp rsi, r10
+  jge .Lend.main.99
+  movsxd r10, dword ptr [rbp-5636]
+  mov qword ptr [rbp-5624], r10
+  jmp .Ljoin.main.4
+.Lend.main.99:
+  movsxd r10, dword ptr [rbp-5628]
+  mov qword ptr [rbp-5624], r10
+.Ljoin.main.4:
+  mov rsi, qword ptr [rbp-5624]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.79]
+  mov qword ptr [rbp-5616], rsi
+  mov rdi, qword ptr [rbp-5600]
+  mov rsi, qword ptr [rbp-5608]
+  cmp rdi, rsi
+  jne .Lelse.main.100
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5616]
+  mov rdx, qword ptr [rbp-5608]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.100
+.Lelse.main.100:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5616]
+  mov r10, qword ptr [rbp-5600]
+  mov rcx, qword ptr [rbp-5608]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.100:
+  mov qword ptr [rbp-5552], 7
+  lea rdi, [rbp-5560]
+  mov dword ptr [rbp-5580], 49
+  mov dword ptr [rbp-5584], 0
+  movsxd rsi, dword ptr [rbp-5584]
+  movsxd r10, dword ptr [rbp-5584]
+  imul rsi, r10
+  movsxd r10, dword ptr [rbp-5580]
+  cmp rsi, r10
+  jg .Lend.main.101
+.align 16
+.Lbegin.main.101:
+  movsxd rsi, dword ptr [rbp-5584]
+  movsxd r10, dword ptr [rbp-5584]
+  imul rsi, r10
+  movsxd r10, dword ptr [rbp-5580]
+  cmp rsi, r10
+  jne .Lend.main.102
+  movsxd r10, dword ptr [rbp-5584]
+  mov qword ptr [rbp-5576], r10
+  jmp .Ljoin.main.5
+.Lend.main.102:
+  movsxd r10, dword ptr [rbp-5584]
+  add r10, 1
+  mov dword ptr [rbp-5584], r10d
+  movsxd rsi, r10d
+  movsxd r10, dword ptr [rbp-5584]
+  imul rsi, r10
+  movsxd r10, dword ptr [rbp-5580]
+  cmp rsi, r10
+  jle .Lbegin.main.101
+.Lend.main.101:
+  mov qword ptr [rbp-5576], -1
+.Ljoin.main.5:
+  mov rsi, qword ptr [rbp-5576]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.80]
+  mov qword ptr [rbp-5568], rsi
+  mov rdi, qword ptr [rbp-5552]
+  mov rsi, qword ptr [rbp-5560]
+  cmp rdi, rsi
+  jne .Lelse.main.103
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5568]
+  mov rdx, qword ptr [rbp-5560]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.103
+.Lelse.main.103:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5568]
+  mov r10, qword ptr [rbp-5552]
+  mov rcx, qword ptr [rbp-5560]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.103:
+  mov qword ptr [rbp-5504], -1
+  lea rdi, [rbp-5512]
+  mov dword ptr [rbp-5532], 50
+  mov dword ptr [rbp-5536], 0
+  movsxd rsi, dword ptr [rbp-5536]
+  movsxd r10, dword ptr [rbp-5536]
+  imul rsi, r10
+  movsxd r10, dword ptr [rbp-5532]
+  cmp rsi, r10
+  jg .Lend.main.104
+.align 16
+.Lbegin.main.104:
+  movsxd rsi, dword ptr [rbp-5536]
+  movsxd r10, dword ptr [rbp-5536]
+  imul rsi, r10
+  movsxd r10, dword ptr [rbp-5532]
+  cmp rsi, r10
+  jne .Lend.main.105
+  movsxd r10, dword ptr [rbp-5536]
+  mov qword ptr [rbp-5528], r10
+  jmp .Ljoin.main.6
+.Lend.main.105:
+  movsxd r10, dword ptr [rbp-5536]
+  add r10, 1
+  mov dword ptr [rbp-5536], r10d
+  movsxd rsi, r10d
+  movsxd r10, dword ptr [rbp-5536]
+  imul rsi, r10
+  movsxd r10, dword ptr [rbp-5532]
+  cmp rsi, r10
+  jle .Lbegin.main.104
+.Lend.main.104:
+  mov qword ptr [rbp-5528], -1
+.Ljoin.main.6:
+  mov rsi, qword ptr [rbp-5528]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.81]
+  mov qword ptr [rbp-5520], rsi
+  mov rdi, qword ptr [rbp-5504]
+  mov rsi, qword ptr [rbp-5512]
+  cmp rdi, rsi
+  jne .Lelse.main.106
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5520]
+  mov rdx, qword ptr [rbp-5512]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.106
+.Lelse.main.106:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5520]
+  mov r10, qword ptr [rbp-5504]
+  mov rcx, qword ptr [rbp-5512]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.106:
+  mov rsi, 15
+  mov qword ptr [rbp-5472], rsi
+  lea rdi, [rbp-5480]
+  push rdi
+  mov rdi, 8
+  sub rsp, 8
+  call clamp2
+  add rsp, 8
+  pop rdi
+  mov rsi, rax
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.82]
+  mov qword ptr [rbp-5488], rsi
+  mov rdi, qword ptr [rbp-5472]
+  mov rsi, qword ptr [rbp-5480]
+  cmp rdi, rsi
+  jne .Lelse.main.107
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5488]
+  mov rdx, qword ptr [rbp-5480]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.107
+.Lelse.main.107:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5488]
+  mov r10, qword ptr [rbp-5472]
+  mov rcx, qword ptr [rbp-5480]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.107:
+  mov rsi, 5
+  mov qword ptr [rbp-5440], rsi
+  lea rdi, [rbp-5448]
+  push rdi
+  mov rdi, -2
+  sub rsp, 8
+  call clamp2
+  add rsp, 8
+  pop rdi
+  mov rsi, rax
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.83]
+  mov qword ptr [rbp-5456], rsi
+  mov rdi, qword ptr [rbp-5440]
+  mov rsi, qword ptr [rbp-5448]
+  cmp rdi, rsi
+  jne .Lelse.main.108
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5456]
+  mov rdx, qword ptr [rbp-5448]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.108
+.Lelse.main.108:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5456]
+  mov r10, qword ptr [rbp-5440]
+  mov rcx, qword ptr [rbp-5448]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.108:
+  mov qword ptr [rbp-5392], 44
+  lea rdi, [rbp-5400]
+  mov byte ptr [rbp-5417], 44
+  movsx r10, byte ptr [rbp-5417]
+  mov qword ptr [rbp-5416], r10
+  mov rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.84]
+  mov qword ptr [rbp-5408], rsi
+  mov rdi, qword ptr [rbp-5392]
+  mov rsi, qword ptr [rbp-5400]
+  cmp rdi, rsi
+  jne .Lelse.main.109
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5408]
+  mov rdx, qword ptr [rbp-5400]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.109
+.Lelse.main.109:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5408]
+  mov r10, qword ptr [rbp-5392]
+  mov rcx, qword ptr [rbp-5400]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.109:
+  movabs rsi, 4294967297
+  mov qword ptr [rbp-5344], rsi
+  lea rdi, [rbp-5352]
+  movabs r10, 4294967297
+  mov qword ptr [rbp-5376], r10
+  mov qword ptr [rbp-5368], r10
+  mov rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.85]
+  mov qword ptr [rbp-5360], rsi
+  mov rdi, qword ptr [rbp-5344]
+  mov rsi, qword ptr [rbp-5352]
+  cmp rdi, rsi
+  jne .Lelse.main.110
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5360]
+  mov rdx, qword ptr [rbp-5352]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.110
+.Lelse.main.110:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5360]
+  mov r10, qword ptr [rbp-5344]
+  mov rcx, qword ptr [rbp-5352]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.110:
+  mov qword ptr [rbp-5312], 4
+  mov qword ptr [rbp-5320], 4
+  lea rsi, [rip+.L.data.main.86]
+  mov qword ptr [rbp-5328], rsi
+  mov rdi, qword ptr [rbp-5312]
+  mov rsi, qword ptr [rbp-5320]
+  cmp rdi, rsi
+  jne .Lelse.main.111
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5328]
+  mov rdx, qword ptr [rbp-5320]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.111
+.Lelse.main.111:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5328]
+  mov r10, qword ptr [rbp-5312]
+  mov rcx, qword ptr [rbp-5320]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.111:
+  mov qword ptr [rbp-5256], 6
+  lea rdi, [rbp-5264]
+  mov dword ptr [rbp-5284], 3
+  movsxd r10, dword ptr [rbp-5284]
+  shl r10, 1
+  mov dword ptr [rbp-5292], r10d
+  movsxd r10, r10d
+  mov dword ptr [rbp-5296], r10d
+  mov dword ptr [rbp-5296], 5
+  movsxd r10, dword ptr [rbp-5292]
+  mov qword ptr [rbp-5280], r10
+.Ljoin.main.7:
+  mov rsi, qword ptr [rbp-5280]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.87]
+  mov qword ptr [rbp-5272], rsi
+  mov rdi, qword ptr [rbp-5256]
+  mov rsi, qword ptr [rbp-5264]
+  cmp rdi, rsi
+  jne .Lelse.main.112
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5272]
+  mov rdx, qword ptr [rbp-5264]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.112
+.Lelse.main.112:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5272]
+  mov r10, qword ptr [rbp-5256]
+  mov rcx, qword ptr [rbp-5264]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.112:
+  mov qword ptr [rbp-5208], 10
+  lea rdi, [rbp-5216]
+  mov dword ptr [rbp-5236], 4
+  mov dword ptr [rbp-5240], 0
+.align 16
+.Lbegin.main.113:
+  movsxd rsi, dword ptr [rbp-5236]
+  cmp rsi, 1
+  jge .Lend.main.114
+  movsxd r10, dword ptr [rbp-5240]
+  mov qword ptr [rbp-5232], r10
+  jmp .Ljoin.main.8
+.Lend.main.114:
+  movsxd r10, dword ptr [rbp-5240]
+  movsxd r11, dword ptr [rbp-5236]
+  add r10, r11
+  mov dword ptr [rbp-5240], r10d
+  movsxd r10, dword ptr [rbp-5236]
+  sub r10, 1
+  mov dword ptr [rbp-5236], r10d
+  jmp .Lbegin.main.113
+.Lend.main.113:
+.Ljoin.main.8:
+  mov rsi, qword ptr [rbp-5232]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.88]
+  mov qword ptr [rbp-5224], rsi
+  mov rdi, qword ptr [rbp-5208]
+  mov rsi, qword ptr [rbp-5216]
+  cmp rdi, rsi
+  jne .Lelse.main.115
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5224]
+  mov rdx, qword ptr [rbp-5216]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.115
+.Lelse.main.115:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5224]
+  mov r10, qword ptr [rbp-5208]
+  mov rcx, qword ptr [rbp-5216]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.115:
+  mov qword ptr [rbp-5160], 15
+  lea rdi, [rbp-5168]
+  mov dword ptr [rbp-5188], 5
+  lea rsi, [rbp-5184]
+  push rdi
+  push rsi
+  movsxd rdi, dword ptr [rbp-5188]
+  xor eax, eax
+  call call_later
+  pop rsi
+  pop rdi
+  mov r10, rax
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-5184]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.89]
+  mov qword ptr [rbp-5176], rsi
+  mov rdi, qword ptr [rbp-5160]
+  mov rsi, qword ptr [rbp-5168]
+  cmp rdi, rsi
+  jne .Lelse.main.116
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5176]
+  mov rdx, qword ptr [rbp-5168]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.116
+.Lelse.main.116:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5176]
+  mov r10, qword ptr [rbp-5160]
+  mov rcx, qword ptr [rbp-5168]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.116:
+  mov qword ptr [rbp-5104], 13
+  lea rdi, [rbp-5112]
+  mov rsi, 1
+  mov dword ptr [rbp-5132], 3
+  mov dword ptr [rbp-5136], 5
+  mov dword ptr [rbp-5140], 9
+  movsxd r10, dword ptr [rbp-5132]
+  movsxd r11, dword ptr [rbp-5136]
+  cmp r10, r11
+  jge .Lend.main.117
+  movsxd r11, dword ptr [rbp-5136]
+  mov qword ptr [rbp-5128], r11
+  jmp .Ljoin.main.9
+.Lend.main.117:
+  movsxd r10, dword ptr [rbp-5140]
+  movsxd r11, dword ptr [rbp-5132]
+  cmp r10, r11
+  jge .Lend.main.118
+  movsxd r11, dword ptr [rbp-5140]
+  mov qword ptr [rbp-5128], r11
+  jmp .Ljoin.main.9
+.Lend.main.118:
+  movsxd r11, dword ptr [rbp-5132]
+  mov qword ptr [rbp-5128], r11
+.Ljoin.main.9:
+  mov r10, qword ptr [rbp-5128]
+  shl r10, 1
+  add rsi, r10
+  push rdi
+  push rsi
+  mov rdi, 0
+  call clamp2
+  pop rsi
+  pop rdi
+  mov r10, rax
+  add rsi, r10
+  sub rsi, 3
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.90]
+  mov qword ptr [rbp-5120], rsi
+  mov rdi, qword ptr [rbp-5104]
+  mov rsi, qword ptr [rbp-5112]
+  cmp rdi, rsi
+  jne .Lelse.main.119
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5120]
+  mov rdx, qword ptr [rbp-5112]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.119
+.Lelse.main.119:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5120]
+  mov r10, qword ptr [rbp-5104]
+  mov rcx, qword ptr [rbp-5112]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.119:
+  mov qword ptr [rbp-5072], 47
+  lea rdi, [rbp-5080]
+  mov dword ptr [rbp-9996], 2
+  mov rsi, 1
+  mov r10, 2
+  mov r11, 3
+  mov r8, 4
+  mov r9, 5
+  push r9
+  mov r9, 6
+  push r9
+  mov r9, 7
+  push r9
+  mov r9, 8
+  push r9
+  mov r9, 9
+  push r9
+  movsxd rcx, dword ptr [rbp-9996]
+  pop r9
+  add r9, rcx
+  mov rcx, r9
+  pop r9
+  add r9, rcx
+  mov rcx, r9
+  pop r9
+  add r9, rcx
+  mov rcx, r9
+  pop r9
+  add r9, rcx
+  mov rcx, r9
+  pop r9
+  add r9, rcx
+  add r8, r9
+  add r11, r8
+  add r10, r11
+  add rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.91]
+  mov qword ptr [rbp-5088], rsi
+  mov rdi, qword ptr [rbp-5072]
+  mov rsi, qword ptr [rbp-5080]
+  cmp rdi, rsi
+  jne .Lelse.main.120
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-5088]
+  mov rdx, qword ptr [rbp-5080]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.120
+.Lelse.main.120:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-5088]
+  mov r10, qword ptr [rbp-5072]
+  mov rcx, qword ptr [rbp-5080]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.120:
+  mov qword ptr [rbp-4976], 58
+  lea rdi, [rbp-4984]
+  mov dword ptr [rbp-5004], 1
+  mov dword ptr [rbp-5008], 2
+  mov dword ptr [rbp-5012], 3
+  mov dword ptr [rbp-5016], 4
+  mov dword ptr [rbp-5020], 5
+  lea rsi, [rbp-5024]
+  mov dword ptr [rbp-5036], 1
+  mov dword ptr [rbp-5040], 2
+  mov dword ptr [rbp-5044], 3
+  mov dword ptr [rbp-5048], 4
+  mov dword ptr [rbp-5052], 5
+  mov dword ptr [rbp-5056], 28
+  lea r10, [rbp-5032]
+  movsxd r11, dword ptr [rbp-5036]
+  movsxd r8, dword ptr [rbp-5040]
+  add r11, r8
+  movsxd r8, dword ptr [rbp-5044]
+  add r11, r8
+  movsxd r8, dword ptr [rbp-5048]
+  add r11, r8
+  movsxd r8, dword ptr [rbp-5052]
+  add r11, r8
+  movsxd r8, dword ptr [rbp-5056]
+  add r11, r8
+  mov qword ptr [r10], r11
+  mov r10, qword ptr [rbp-5032]
+  mov dword ptr [rsi], r10d
+  lea rsi, [rbp-5000]
+  movsxd r10, dword ptr [rbp-5004]
+  movsxd r11, dword ptr [rbp-5008]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5012]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5016]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5020]
+  add r10, r11
+  movsxd r11, dword ptr [rbp-5024]
+  add r10, r11
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-5000]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.92]
+  mov qword ptr [rbp-4992], rsi
+  mov rdi, qword ptr [rbp-4976]
+  mov rsi, qword ptr [rbp-4984]
+  cmp rdi, rsi
+  jne .Lelse.main.121
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4992]
+  mov rdx, qword ptr [rbp-4984]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.121
+.Lelse.main.121:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4992]
+  mov r10, qword ptr [rbp-4976]
+  mov rcx, qword ptr [rbp-4984]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.121:
+  mov qword ptr [rbp-4944], 3
+  mov dword ptr [rbp-9992], 3
+  movsxd rsi, dword ptr [rbp-9992]
+  mov qword ptr [rbp-4952], rsi
+  lea rsi, [rip+.L.data.main.93]
+  mov qword ptr [rbp-4960], rsi
+  mov rdi, qword ptr [rbp-4944]
+  mov rsi, qword ptr [rbp-4952]
+  cmp rdi, rsi
+  jne .Lelse.main.122
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4960]
+  mov rdx, qword ptr [rbp-4952]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.122
+.Lelse.main.122:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4960]
+  mov r10, qword ptr [rbp-4944]
+  mov rcx, qword ptr [rbp-4952]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.122:
+  mov qword ptr [rbp-4912], 3
+  lea rdi, [rbp-4920]
+  mov dword ptr [rbp-9988], 3
+  lea r10, [rbp-9988]
+  mov qword ptr [rbp-9984], r10
+  lea r10, [rbp-9984]
+  mov qword ptr [rbp-9976], r10
+  mov rsi, r10
+  mov rsi, qword ptr [rsi]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.94]
+  mov qword ptr [rbp-4928], rsi
+  mov rdi, qword ptr [rbp-4912]
+  mov rsi, qword ptr [rbp-4920]
+  cmp rdi, rsi
+  jne .Lelse.main.123
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4928]
+  mov rdx, qword ptr [rbp-4920]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.123
+.Lelse.main.123:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4928]
+  mov r10, qword ptr [rbp-4912]
+  mov rcx, qword ptr [rbp-4920]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.123:
+  mov qword ptr [rbp-4880], 5
+  mov dword ptr [rbp-9968], 3
+  mov dword ptr [rbp-9964], 5
+  movsxd rsi, dword ptr [rbp-9964]
+  mov qword ptr [rbp-4888], rsi
+  lea rsi, [rip+.L.data.main.95]
+  mov qword ptr [rbp-4896], rsi
+  mov rdi, qword ptr [rbp-4880]
+  mov rsi, qword ptr [rbp-4888]
+  cmp rdi, rsi
+  jne .Lelse.main.124
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4896]
+  mov rdx, qword ptr [rbp-4888]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.124
+.Lelse.main.124:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4896]
+  mov r10, qword ptr [rbp-4880]
+  mov rcx, qword ptr [rbp-4888]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.124:
+  mov qword ptr [rbp-4848], 5
+  mov dword ptr [rbp-9960], 3
+  mov dword ptr [rbp-9956], 5
+  movsxd rsi, dword ptr [rbp-9956]
+  mov qword ptr [rbp-4856], rsi
+  lea rsi, [rip+.L.data.main.96]
+  mov qword ptr [rbp-4864], rsi
+  mov rdi, qword ptr [rbp-4848]
+  mov rsi, qword ptr [rbp-4856]
+  cmp rdi, rsi
+  jne .Lelse.main.125
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4864]
+  mov rdx, qword ptr [rbp-4856]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.125
+.Lelse.main.125:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4864]
+  mov r10, qword ptr [rbp-4848]
+  mov rcx, qword ptr [rbp-4856]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.125:
+  mov qword ptr [rbp-4816], 3
+  mov dword ptr [rbp-9952], 3
+  mov dword ptr [rbp-9948], 5
+  movsxd rsi, dword ptr [rbp-9952]
+  mov qword ptr [rbp-4824], rsi
+  lea rsi, [rip+.L.data.main.97]
+  mov qword ptr [rbp-4832], rsi
+  mov rdi, qword ptr [rbp-4816]
+  mov rsi, qword ptr [rbp-4824]
+  cmp rdi, rsi
+  jne .Lelse.main.126
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4832]
+  mov rdx, qword ptr [rbp-4824]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.126
+.Lelse.main.126:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4832]
+  mov r10, qword ptr [rbp-4816]
+  mov rcx, qword ptr [rbp-4824]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.126:
+  mov qword ptr [rbp-4784], 5
+  lea rdi, [rbp-4792]
+  mov dword ptr [rbp-9944], 3
+  mov dword ptr [rbp-9940], 5
+  lea r10, [rbp-9944]
+  mov qword ptr [rbp-9936], r10
+  mov rsi, r10
+  add rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.98]
+  mov qword ptr [rbp-4800], rsi
+  mov rdi, qword ptr [rbp-4784]
+  mov rsi, qword ptr [rbp-4792]
+  cmp rdi, rsi
+  jne .Lelse.main.127
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4800]
+  mov rdx, qword ptr [rbp-4792]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.127
+.Lelse.main.127:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4800]
+  mov r10, qword ptr [rbp-4784]
+  mov rcx, qword ptr [rbp-4792]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.127:
+  mov qword ptr [rbp-4752], 3
+  lea rdi, [rbp-4760]
+  mov dword ptr [rbp-9928], 3
+  mov dword ptr [rbp-9924], 5
+  lea r10, [rbp-9924]
+  mov qword ptr [rbp-9920], r10
+  mov rsi, r10
+  sub rsi, 4
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.99]
+  mov qword ptr [rbp-4768], rsi
+  mov rdi, qword ptr [rbp-4752]
+  mov rsi, qword ptr [rbp-4760]
+  cmp rdi, rsi
+  jne .Lelse.main.128
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4768]
+  mov rdx, qword ptr [rbp-4760]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.128
+.Lelse.main.128:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4768]
+  mov r10, qword ptr [rbp-4752]
+  mov rcx, qword ptr [rbp-4760]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.128:
+  mov qword ptr [rbp-4720], 5
+  lea rdi, [rbp-4728]
+  mov dword ptr [rbp-9908], 3
+  lea r10, [rbp-9908]
+  mov qword ptr [rbp-9904], r10
+  mov rsi, r10
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rbp-9908]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.100]
+  mov qword ptr [rbp-4736], rsi
+  mov rdi, qword ptr [rbp-4720]
+  mov rsi, qword ptr [rbp-4728]
+  cmp rdi, rsi
+  jne .Lelse.main.129
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4736]
+  mov rdx, qword ptr [rbp-4728]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.129
+.Lelse.main.129:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4736]
+  mov r10, qword ptr [rbp-4720]
+  mov rcx, qword ptr [rbp-4728]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.129:
+  mov qword ptr [rbp-4688], 7
+  lea rdi, [rbp-4696]
+  mov dword ptr [rbp-9896], 3
+  mov dword ptr [rbp-9892], 5
+  mov dword ptr [rbp-9892], 7
+  movsxd rsi, dword ptr [rbp-9892]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.101]
+  mov qword ptr [rbp-4704], rsi
+  mov rdi, qword ptr [rbp-4688]
+  mov rsi, qword ptr [rbp-4696]
+  cmp rdi, rsi
+  jne .Lelse.main.130
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4704]
+  mov rdx, qword ptr [rbp-4696]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.130
+.Lelse.main.130:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4704]
+  mov r10, qword ptr [rbp-4688]
+  mov rcx, qword ptr [rbp-4696]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.130:
+  mov qword ptr [rbp-4656], 7
+  lea rdi, [rbp-4664]
+  mov dword ptr [rbp-9888], 3
+  mov dword ptr [rbp-9884], 5
+  mov dword ptr [rbp-9888], 7
+  movsxd rsi, dword ptr [rbp-9888]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.102]
+  mov qword ptr [rbp-4672], rsi
+  mov rdi, qword ptr [rbp-4656]
+  mov rsi, qword ptr [rbp-4664]
+  cmp rdi, rsi
+  jne .Lelse.main.131
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4672]
+  mov rdx, qword ptr [rbp-4664]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.131
+.Lelse.main.131:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4672]
+  mov r10, qword ptr [rbp-4656]
+  mov rcx, qword ptr [rbp-4664]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.131:
+  mov qword ptr [rbp-4600], 8
+  lea rdi, [rbp-4608]
+  mov dword ptr [rbp-9880], 3
+  mov dword ptr [rbp-9876], 5
+  lea r10, [rbp-9880]
+  mov qword ptr [rbp-4632], r10
+  movsxd r10, dword ptr [rbp-9876]
+  mov dword ptr [rbp-4636], r10d
+  lea rsi, [rbp-4624]
+  mov r10, qword ptr [rbp-4632]
+  movsxd r10, dword ptr [r10]
+  movsxd r11, dword ptr [rbp-4636]
+  add r10, r11
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-4624]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.103]
+  mov qword ptr [rbp-4616], rsi
+  mov rdi, qword ptr [rbp-4600]
+  mov rsi, qword ptr [rbp-4608]
+  cmp rdi, rsi
+  jne .Lelse.main.132
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4616]
+  mov rdx, qword ptr [rbp-4608]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.132
+.Lelse.main.132:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4616]
+  mov r10, qword ptr [rbp-4600]
+  mov rcx, qword ptr [rbp-4608]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.132:
+  mov qword ptr [rbp-4568], 3
+  lea rdi, [rbp-4576]
+  lea r10, [rbp-9872]
+  mov qword ptr [rbp-9864], r10
+  mov rsi, r10
+  mov dword ptr [rsi], 3
+  movsxd rsi, dword ptr [rbp-9872]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.104]
+  mov qword ptr [rbp-4584], rsi
+  mov rdi, qword ptr [rbp-4568]
+  mov rsi, qword ptr [rbp-4576]
+  cmp rdi, rsi
+  jne .Lelse.main.133
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4584]
+  mov rdx, qword ptr [rbp-4576]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.133
+.Lelse.main.133:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4584]
+  mov r10, qword ptr [rbp-4568]
+  mov rcx, qword ptr [rbp-4576]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.133:
+  mov qword ptr [rbp-4536], 3
+  lea rdi, [rbp-4544]
+  mov dword ptr [rbp-9852], 3
+  mov dword ptr [rbp-9848], 4
+  mov dword ptr [rbp-9844], 5
+  movsxd rsi, dword ptr [rbp-9852]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.105]
+  mov qword ptr [rbp-4552], rsi
+  mov rdi, qword ptr [rbp-4536]
+  mov rsi, qword ptr [rbp-4544]
+  cmp rdi, rsi
+  jne .Lelse.main.134
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4552]
+  mov rdx, qword ptr [rbp-4544]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.134
+.Lelse.main.134:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4552]
+  mov r10, qword ptr [rbp-4536]
+  mov rcx, qword ptr [rbp-4544]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.134:
+  mov qword ptr [rbp-4504], 4
+  lea rdi, [rbp-4512]
+  mov dword ptr [rbp-9840], 3
+  mov dword ptr [rbp-9836], 4
+  mov dword ptr [rbp-9832], 5
+  movsxd rsi, dword ptr [rbp-9836]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.106]
+  mov qword ptr [rbp-4520], rsi
+  mov rdi, qword ptr [rbp-4504]
+  mov rsi, qword ptr [rbp-4512]
+  cmp rdi, rsi
+  jne .Lelse.main.135
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4520]
+  mov rdx, qword ptr [rbp-4512]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.135
+.Lelse.main.135:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4520]
+  mov r10, qword ptr [rbp-4504]
+  mov rcx, qword ptr [rbp-4512]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.135:
+  mov qword ptr [rbp-4472], 5
+  lea rdi, [rbp-4480]
+  mov dword ptr [rbp-9828], 3
+  mov dword ptr [rbp-9824], 4
+  mov dword ptr [rbp-9820], 5
+  movsxd rsi, dword ptr [rbp-9820]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.107]
+  mov qword ptr [rbp-4488], rsi
+  mov rdi, qword ptr [rbp-4472]
+  mov rsi, qword ptr [rbp-4480]
+  cmp rdi, rsi
+  jne .Lelse.main.136
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4488]
+  mov rdx, qword ptr [rbp-4480]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.136
+.Lelse.main.136:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4488]
+  mov r10, qword ptr [rbp-4472]
+  mov rcx, qword ptr [rbp-4480]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.136:
+  mov qword ptr [rbp-4440], 0
+  lea rdi, [rbp-4448]
+  lea r10, [rbp-9816]
+  mov qword ptr [rbp-9792], r10
+  mov rsi, r10
+  mov dword ptr [rsi], 0
+  movsxd rsi, dword ptr [rbp-9816]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.108]
+  mov qword ptr [rbp-4456], rsi
+  mov rdi, qword ptr [rbp-4440]
+  mov rsi, qword ptr [rbp-4448]
+  cmp rdi, rsi
+  jne .Lelse.main.137
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4456]
+  mov rdx, qword ptr [rbp-4448]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.137
+.Lelse.main.137:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4456]
+  mov r10, qword ptr [rbp-4440]
+  mov rcx, qword ptr [rbp-4448]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.137:
+  mov qword ptr [rbp-4408], 1
+  lea rdi, [rbp-4416]
+  lea r10, [rbp-9784]
+  mov qword ptr [rbp-9760], r10
+  mov rsi, r10
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  movsxd rsi, dword ptr [rbp-9780]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.109]
+  mov qword ptr [rbp-4424], rsi
+  mov rdi, qword ptr [rbp-4408]
+  mov rsi, qword ptr [rbp-4416]
+  cmp rdi, rsi
+  jne .Lelse.main.138
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4424]
+  mov rdx, qword ptr [rbp-4416]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.138
+.Lelse.main.138:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4424]
+  mov r10, qword ptr [rbp-4408]
+  mov rcx, qword ptr [rbp-4416]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.138:
+  mov qword ptr [rbp-4376], 2
+  lea rdi, [rbp-4384]
+  lea r10, [rbp-9752]
+  mov qword ptr [rbp-9728], r10
+  mov rsi, r10
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  movsxd rsi, dword ptr [rbp-9744]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.110]
+  mov qword ptr [rbp-4392], rsi
+  mov rdi, qword ptr [rbp-4376]
+  mov rsi, qword ptr [rbp-4384]
+  cmp rdi, rsi
+  jne .Lelse.main.139
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4392]
+  mov rdx, qword ptr [rbp-4384]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.139
+.Lelse.main.139:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4392]
+  mov r10, qword ptr [rbp-4376]
+  mov rcx, qword ptr [rbp-4384]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.139:
+  mov qword ptr [rbp-4344], 3
+  lea rdi, [rbp-4352]
+  lea r10, [rbp-9720]
+  mov qword ptr [rbp-9696], r10
+  mov rsi, r10
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  movsxd rsi, dword ptr [rbp-9708]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.111]
+  mov qword ptr [rbp-4360], rsi
+  mov rdi, qword ptr [rbp-4344]
+  mov rsi, qword ptr [rbp-4352]
+  cmp rdi, rsi
+  jne .Lelse.main.140
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4360]
+  mov rdx, qword ptr [rbp-4352]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.140
+.Lelse.main.140:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4360]
+  mov r10, qword ptr [rbp-4344]
+  mov rcx, qword ptr [rbp-4352]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.140:
+  mov qword ptr [rbp-4312], 4
+  lea rdi, [rbp-4320]
+  lea r10, [rbp-9688]
+  mov qword ptr [rbp-9664], r10
+  mov rsi, r10
+  add rsi, 16
+  mov dword ptr [rsi], 4
+  movsxd rsi, dword ptr [rbp-9672]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.112]
+  mov qword ptr [rbp-4328], rsi
+  mov rdi, qword ptr [rbp-4312]
+  mov rsi, qword ptr [rbp-4320]
+  cmp rdi, rsi
+  jne .Lelse.main.141
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4328]
+  mov rdx, qword ptr [rbp-4320]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.141
+.Lelse.main.141:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4328]
+  mov r10, qword ptr [rbp-4312]
+  mov rcx, qword ptr [rbp-4320]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.141:
+  mov qword ptr [rbp-4280], 5
+  lea rdi, [rbp-4288]
+  lea r10, [rbp-9656]
+  mov qword ptr [rbp-9632], r10
+  mov rsi, r10
+  add rsi, 20
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rbp-9636]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.113]
+  mov qword ptr [rbp-4296], rsi
+  mov rdi, qword ptr [rbp-4280]
+  mov rsi, qword ptr [rbp-4288]
+  cmp rdi, rsi
+  jne .Lelse.main.142
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4296]
+  mov rdx, qword ptr [rbp-4288]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.142
+.Lelse.main.142:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4296]
+  mov r10, qword ptr [rbp-4280]
+  mov rcx, qword ptr [rbp-4288]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.142:
+  mov qword ptr [rbp-4248], 6
+  lea rdi, [rbp-4256]
+  lea r10, [rbp-9624]
+  mov qword ptr [rbp-9600], r10
+  mov rsi, r10
+  add rsi, 24
+  mov dword ptr [rsi], 6
+  movsxd rsi, dword ptr [rbp-9600]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.114]
+  mov qword ptr [rbp-4264], rsi
+  mov rdi, qword ptr [rbp-4248]
+  mov rsi, qword ptr [rbp-4256]
+  cmp rdi, rsi
+  jne .Lelse.main.143
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4264]
+  mov rdx, qword ptr [rbp-4256]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.143
+.Lelse.main.143:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4264]
+  mov r10, qword ptr [rbp-4248]
+  mov rcx, qword ptr [rbp-4256]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.143:
+  mov qword ptr [rbp-4216], 3
+  lea rdi, [rbp-4224]
+  mov dword ptr [rbp-9588], 3
+  mov dword ptr [rbp-9584], 4
+  mov dword ptr [rbp-9580], 5
+  movsxd rsi, dword ptr [rbp-9588]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.115]
+  mov qword ptr [rbp-4232], rsi
+  mov rdi, qword ptr [rbp-4216]
+  mov rsi, qword ptr [rbp-4224]
+  cmp rdi, rsi
+  jne .Lelse.main.144
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4232]
+  mov rdx, qword ptr [rbp-4224]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.144
+.Lelse.main.144:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4232]
+  mov r10, qword ptr [rbp-4216]
+  mov rcx, qword ptr [rbp-4224]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.144:
+  mov qword ptr [rbp-4184], 4
+  lea rdi, [rbp-4192]
+  mov dword ptr [rbp-9576], 3
+  mov dword ptr [rbp-9572], 4
+  mov dword ptr [rbp-9568], 5
+  movsxd rsi, dword ptr [rbp-9572]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.116]
+  mov qword ptr [rbp-4200], rsi
+  mov rdi, qword ptr [rbp-4184]
+  mov rsi, qword ptr [rbp-4192]
+  cmp rdi, rsi
+  jne .Lelse.main.145
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4200]
+  mov rdx, qword ptr [rbp-4192]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.145
+.Lelse.main.145:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4200]
+  mov r10, qword ptr [rbp-4184]
+  mov rcx, qword ptr [rbp-4192]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.145:
+  mov qword ptr [rbp-4152], 5
+  lea rdi, [rbp-4160]
+  mov dword ptr [rbp-9564], 3
+  mov dword ptr [rbp-9560], 4
+  mov dword ptr [rbp-9556], 5
+  movsxd rsi, dword ptr [rbp-9556]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.117]
+  mov qword ptr [rbp-4168], rsi
+  mov rdi, qword ptr [rbp-4152]
+  mov rsi, qword ptr [rbp-4160]
+  cmp rdi, rsi
+  jne .Lelse.main.146
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4168]
+  mov rdx, qword ptr [rbp-4160]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.146
+.Lelse.main.146:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4168]
+  mov r10, qword ptr [rbp-4152]
+  mov rcx, qword ptr [rbp-4160]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.146:
+  mov qword ptr [rbp-4120], 5
+  lea rdi, [rbp-4128]
+  mov dword ptr [rbp-9552], 3
+  mov dword ptr [rbp-9548], 4
+  mov dword ptr [rbp-9544], 5
+  movsxd rsi, dword ptr [rbp-9544]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.118]
+  mov qword ptr [rbp-4136], rsi
+  mov rdi, qword ptr [rbp-4120]
+  mov rsi, qword ptr [rbp-4128]
+  cmp rdi, rsi
+  jne .Lelse.main.147
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4136]
+  mov rdx, qword ptr [rbp-4128]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.147
+.Lelse.main.147:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4136]
+  mov r10, qword ptr [rbp-4120]
+  mov rcx, qword ptr [rbp-4128]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.147:
+  mov qword ptr [rbp-4088], 5
+  lea rdi, [rbp-4096]
+  mov dword ptr [rbp-9540], 3
+  mov dword ptr [rbp-9536], 4
+  mov dword ptr [rbp-9532], 5
+  movsxd rsi, dword ptr [rbp-9532]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.119]
+  mov qword ptr [rbp-4104], rsi
+  mov rdi, qword ptr [rbp-4088]
+  mov rsi, qword ptr [rbp-4096]
+  cmp rdi, rsi
+  jne .Lelse.main.148
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4104]
+  mov rdx, qword ptr [rbp-4096]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.148
+.Lelse.main.148:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4104]
+  mov r10, qword ptr [rbp-4088]
+  mov rcx, qword ptr [rbp-4096]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.148:
+  mov qword ptr [rbp-4056], 0
+  lea rdi, [rbp-4064]
+  lea r10, [rbp-9528]
+  mov qword ptr [rbp-9504], r10
+  mov rsi, r10
+  mov dword ptr [rsi], 0
+  movsxd rsi, dword ptr [rbp-9528]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.120]
+  mov qword ptr [rbp-4072], rsi
+  mov rdi, qword ptr [rbp-4056]
+  mov rsi, qword ptr [rbp-4064]
+  cmp rdi, rsi
+  jne .Lelse.main.149
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4072]
+  mov rdx, qword ptr [rbp-4064]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.149
+.Lelse.main.149:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4072]
+  mov r10, qword ptr [rbp-4056]
+  mov rcx, qword ptr [rbp-4064]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.149:
+  mov qword ptr [rbp-4024], 1
+  lea rdi, [rbp-4032]
+  lea r10, [rbp-9496]
+  mov qword ptr [rbp-9472], r10
+  mov rsi, r10
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  movsxd rsi, dword ptr [rbp-9492]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.121]
+  mov qword ptr [rbp-4040], rsi
+  mov rdi, qword ptr [rbp-4024]
+  mov rsi, qword ptr [rbp-4032]
+  cmp rdi, rsi
+  jne .Lelse.main.150
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4040]
+  mov rdx, qword ptr [rbp-4032]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.150
+.Lelse.main.150:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4040]
+  mov r10, qword ptr [rbp-4024]
+  mov rcx, qword ptr [rbp-4032]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.150:
+  mov qword ptr [rbp-3992], 2
+  lea rdi, [rbp-4000]
+  lea r10, [rbp-9464]
+  mov qword ptr [rbp-9440], r10
+  mov rsi, r10
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  movsxd rsi, dword ptr [rbp-9456]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.122]
+  mov qword ptr [rbp-4008], rsi
+  mov rdi, qword ptr [rbp-3992]
+  mov rsi, qword ptr [rbp-4000]
+  cmp rdi, rsi
+  jne .Lelse.main.151
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-4008]
+  mov rdx, qword ptr [rbp-4000]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.151
+.Lelse.main.151:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-4008]
+  mov r10, qword ptr [rbp-3992]
+  mov rcx, qword ptr [rbp-4000]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.151:
+  mov qword ptr [rbp-3960], 3
+  lea rdi, [rbp-3968]
+  lea r10, [rbp-9432]
+  mov qword ptr [rbp-9408], r10
+  mov rsi, r10
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  movsxd rsi, dword ptr [rbp-9420]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.123]
+  mov qword ptr [rbp-3976], rsi
+  mov rdi, qword ptr [rbp-3960]
+  mov rsi, qword ptr [rbp-3968]
+  cmp rdi, rsi
+  jne .Lelse.main.152
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3976]
+  mov rdx, qword ptr [rbp-3968]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.152
+.Lelse.main.152:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3976]
+  mov r10, qword ptr [rbp-3960]
+  mov rcx, qword ptr [rbp-3968]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.152:
+  mov qword ptr [rbp-3928], 4
+  lea rdi, [rbp-3936]
+  lea r10, [rbp-9400]
+  mov qword ptr [rbp-9376], r10
+  mov rsi, r10
+  add rsi, 16
+  mov dword ptr [rsi], 4
+  movsxd rsi, dword ptr [rbp-9384]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.124]
+  mov qword ptr [rbp-3944], rsi
+  mov rdi, qword ptr [rbp-3928]
+  mov rsi, qword ptr [rbp-3936]
+  cmp rdi, rsi
+  jne .Lelse.main.153
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3944]
+  mov rdx, qword ptr [rbp-3936]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.153
+.Lelse.main.153:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3944]
+  mov r10, qword ptr [rbp-3928]
+  mov rcx, qword ptr [rbp-3936]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.153:
+  mov qword ptr [rbp-3896], 5
+  lea rdi, [rbp-3904]
+  lea r10, [rbp-9368]
+  mov qword ptr [rbp-9344], r10
+  mov rsi, r10
+  add rsi, 20
+  mov dword ptr [rsi], 5
+  movsxd rsi, dword ptr [rbp-9348]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.125]
+  mov qword ptr [rbp-3912], rsi
+  mov rdi, qword ptr [rbp-3896]
+  mov rsi, qword ptr [rbp-3904]
+  cmp rdi, rsi
+  jne .Lelse.main.154
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3912]
+  mov rdx, qword ptr [rbp-3904]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.154
+.Lelse.main.154:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3912]
+  mov r10, qword ptr [rbp-3896]
+  mov rcx, qword ptr [rbp-3904]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.154:
+  mov qword ptr [rbp-3864], 6
+  lea rdi, [rbp-3872]
+  lea r10, [rbp-9336]
+  mov qword ptr [rbp-9312], r10
+  mov rsi, r10
+  add rsi, 24
+  mov dword ptr [rsi], 6
+  movsxd rsi, dword ptr [rbp-9312]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.126]
+  mov qword ptr [rbp-3880], rsi
+  mov rdi, qword ptr [rbp-3864]
+  mov rsi, qword ptr [rbp-3872]
+  cmp rdi, rsi
+  jne .Lelse.main.155
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3880]
+  mov rdx, qword ptr [rbp-3872]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.155
+.Lelse.main.155:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3880]
+  mov r10, qword ptr [rbp-3864]
+  mov rcx, qword ptr [rbp-3872]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.155:
+  mov qword ptr [rbp-3832], 4
+  mov qword ptr [rbp-3840], 4
+  lea rsi, [rip+.L.data.main.127]
+  mov qword ptr [rbp-3848], rsi
+  mov rdi, qword ptr [rbp-3832]
+  mov rsi, qword ptr [rbp-3840]
+  cmp rdi, rsi
+  jne .Lelse.main.156
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3848]
+  mov rdx, qword ptr [rbp-3840]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.156
+.Lelse.main.156:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3848]
+  mov r10, qword ptr [rbp-3832]
+  mov rcx, qword ptr [rbp-3840]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.156:
+  mov qword ptr [rbp-3800], 4
+  mov qword ptr [rbp-3808], 4
+  lea rsi, [rip+.L.data.main.128]
+  mov qword ptr [rbp-3816], rsi
+  mov rdi, qword ptr [rbp-3800]
+  mov rsi, qword ptr [rbp-3808]
+  cmp rdi, rsi
+  jne .Lelse.main.157
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3816]
+  mov rdx, qword ptr [rbp-3808]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.157
+.Lelse.main.157:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3816]
+  mov r10, qword ptr [rbp-3800]
+  mov rcx, qword ptr [rbp-3808]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.157:
+  mov qword ptr [rbp-3768], 8
+  mov qword ptr [rbp-3776], 8
+  lea rsi, [rip+.L.data.main.129]
+  mov qword ptr [rbp-3784], rsi
+  mov rdi, qword ptr [rbp-3768]
+  mov rsi, qword ptr [rbp-3776]
+  cmp rdi, rsi
+  jne .Lelse.main.158
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3784]
+  mov rdx, qword ptr [rbp-3776]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.158
+.Lelse.main.158:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3784]
+  mov r10, qword ptr [rbp-3768]
+  mov rcx, qword ptr [rbp-3776]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.158:
+  mov qword ptr [rbp-3736], 16
+  mov qword ptr [rbp-3744], 16
+  lea rsi, [rip+.L.data.main.130]
+  mov qword ptr [rbp-3752], rsi
+  mov rdi, qword ptr [rbp-3736]
+  mov rsi, qword ptr [rbp-3744]
+  cmp rdi, rsi
+  jne .Lelse.main.159
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3752]
+  mov rdx, qword ptr [rbp-3744]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.159
+.Lelse.main.159:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3752]
+  mov r10, qword ptr [rbp-3736]
+  mov rcx, qword ptr [rbp-3744]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.159:
+  mov qword ptr [rbp-3704], 48
+  mov qword ptr [rbp-3712], 48
+  lea rsi, [rip+.L.data.main.131]
+  mov qword ptr [rbp-3720], rsi
+  mov rdi, qword ptr [rbp-3704]
+  mov rsi, qword ptr [rbp-3712]
+  cmp rdi, rsi
+  jne .Lelse.main.160
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3720]
+  mov rdx, qword ptr [rbp-3712]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.160
+.Lelse.main.160:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3720]
+  mov r10, qword ptr [rbp-3704]
+  mov rcx, qword ptr [rbp-3712]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.160:
+  mov qword ptr [rbp-3672], 16
+  mov qword ptr [rbp-3680], 16
+  lea rsi, [rip+.L.data.main.132]
+  mov qword ptr [rbp-3688], rsi
+  mov rdi, qword ptr [rbp-3672]
+  mov rsi, qword ptr [rbp-3680]
+  cmp rdi, rsi
+  jne .Lelse.main.161
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3688]
+  mov rdx, qword ptr [rbp-3680]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.161
+.Lelse.main.161:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3688]
+  mov r10, qword ptr [rbp-3672]
+  mov rcx, qword ptr [rbp-3680]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.161:
+  mov qword ptr [rbp-3640], 4
+  mov qword ptr [rbp-3648], 4
+  lea rsi, [rip+.L.data.main.133]
+  mov qword ptr [rbp-3656], rsi
+  mov rdi, qword ptr [rbp-3640]
+  mov rsi, qword ptr [rbp-3648]
+  cmp rdi, rsi
+  jne .Lelse.main.162
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3656]
+  mov rdx, qword ptr [rbp-3648]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.162
+.Lelse.main.162:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3656]
+  mov r10, qword ptr [rbp-3640]
+  mov rcx, qword ptr [rbp-3648]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.162:
+  mov qword ptr [rbp-3608], 5
+  mov qword ptr [rbp-3616], 5
+  lea rsi, [rip+.L.data.main.134]
+  mov qword ptr [rbp-3624], rsi
+  mov rdi, qword ptr [rbp-3608]
+  mov rsi, qword ptr [rbp-3616]
+  cmp rdi, rsi
+  jne .Lelse.main.163
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3624]
+  mov rdx, qword ptr [rbp-3616]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.163
+.Lelse.main.163:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3624]
+  mov r10, qword ptr [rbp-3608]
+  mov rcx, qword ptr [rbp-3616]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.163:
+  mov qword ptr [rbp-3576], 5
+  mov qword ptr [rbp-3584], 5
+  lea rsi, [rip+.L.data.main.135]
+  mov qword ptr [rbp-3592], rsi
+  mov rdi, qword ptr [rbp-3576]
+  mov rsi, qword ptr [rbp-3584]
+  cmp rdi, rsi
+  jne .Lelse.main.164
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3592]
+  mov rdx, qword ptr [rbp-3584]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.164
+.Lelse.main.164:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3592]
+  mov r10, qword ptr [rbp-3576]
+  mov rcx, qword ptr [rbp-3584]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.164:
+  mov qword ptr [rbp-3544], 4
+  mov qword ptr [rbp-3552], 4
+  lea rsi, [rip+.L.data.main.136]
+  mov qword ptr [rbp-3560], rsi
+  mov rdi, qword ptr [rbp-3544]
+  mov rsi, qword ptr [rbp-3552]
+  cmp rdi, rsi
+  jne .Lelse.main.165
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3560]
+  mov rdx, qword ptr [rbp-3552]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.165
+.Lelse.main.165:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3560]
+  mov r10, qword ptr [rbp-3544]
+  mov rcx, qword ptr [rbp-3552]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.165:
+  mov qword ptr [rbp-3512], 0
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rbp-3520], rsi
+  lea rsi, [rip+.L.data.main.137]
+  mov qword ptr [rbp-3528], rsi
+  mov rdi, qword ptr [rbp-3512]
+  mov rsi, qword ptr [rbp-3520]
+  cmp rdi, rsi
+  jne .Lelse.main.166
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3528]
+  mov rdx, qword ptr [rbp-3520]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.166
+.Lelse.main.166:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3528]
+  mov r10, qword ptr [rbp-3512]
+  mov rcx, qword ptr [rbp-3520]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.166:
+  mov dword ptr [rip+g1], 3
+  mov qword ptr [rbp-3480], 3
+  movsxd rsi, dword ptr [rip+g1]
+  mov qword ptr [rbp-3488], rsi
+  lea rsi, [rip+.L.data.main.138]
+  mov qword ptr [rbp-3496], rsi
+  mov rdi, qword ptr [rbp-3480]
+  mov rsi, qword ptr [rbp-3488]
+  cmp rdi, rsi
+  jne .Lelse.main.167
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3496]
+  mov rdx, qword ptr [rbp-3488]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.167
+.Lelse.main.167:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3496]
+  mov r10, qword ptr [rbp-3480]
+  mov rcx, qword ptr [rbp-3488]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.167:
+  mov dword ptr [rip+g2], 0
+  mov dword ptr [rip+g2+4], 1
+  mov dword ptr [rip+g2+8], 2
+  mov dword ptr [rip+g2+12], 3
+  mov qword ptr [rbp-3448], 0
+  movsxd rsi, dword ptr [rip+g2]
+  mov qword ptr [rbp-3456], rsi
+  lea rsi, [rip+.L.data.main.139]
+  mov qword ptr [rbp-3464], rsi
+  mov rdi, qword ptr [rbp-3448]
+  mov rsi, qword ptr [rbp-3456]
+  cmp rdi, rsi
+  jne .Lelse.main.168
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3464]
+  mov rdx, qword ptr [rbp-3456]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.168
+.Lelse.main.168:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3464]
+  mov r10, qword ptr [rbp-3448]
+  mov rcx, qword ptr [rbp-3456]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.168:
+  mov qword ptr [rbp-3416], 1
+  movsxd rsi, dword ptr [rip+g2+4]
+  mov qword ptr [rbp-3424], rsi
+  lea rsi, [rip+.L.data.main.140]
+  mov qword ptr [rbp-3432], rsi
+  mov rdi, qword ptr [rbp-3416]
+  mov rsi, qword ptr [rbp-3424]
+  cmp rdi, rsi
+  jne .Lelse.main.169
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3432]
+  mov rdx, qword ptr [rbp-3424]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.169
+.Lelse.main.169:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3432]
+  mov r10, qword ptr [rbp-3416]
+  mov rcx, qword ptr [rbp-3424]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.169:
+  mov qword ptr [rbp-3384], 2
+  movsxd rsi, dword ptr [rip+g2+8]
+  mov qword ptr [rbp-3392], rsi
+  lea rsi, [rip+.L.data.main.141]
+  mov qword ptr [rbp-3400], rsi
+  mov rdi, qword ptr [rbp-3384]
+  mov rsi, qword ptr [rbp-3392]
+  cmp rdi, rsi
+  jne .Lelse.main.170
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3400]
+  mov rdx, qword ptr [rbp-3392]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.170
+.Lelse.main.170:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3400]
+  mov r10, qword ptr [rbp-3384]
+  mov rcx, qword ptr [rbp-3392]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.170:
+  mov qword ptr [rbp-3352], 3
+  movsxd rsi, dword ptr [rip+g2+12]
+  mov qword ptr [rbp-3360], rsi
+  lea rsi, [rip+.L.data.main.142]
+  mov qword ptr [rbp-3368], rsi
+  mov rdi, qword ptr [rbp-3352]
+  mov rsi, qword ptr [rbp-3360]
+  cmp rdi, rsi
+  jne .Lelse.main.171
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3368]
+  mov rdx, qword ptr [rbp-3360]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.171
+.Lelse.main.171:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3368]
+  mov r10, qword ptr [rbp-3352]
+  mov rcx, qword ptr [rbp-3360]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.171:
+  mov qword ptr [rbp-3320], 4
+  mov qword ptr [rbp-3328], 4
+  lea rsi, [rip+.L.data.main.143]
+  mov qword ptr [rbp-3336], rsi
+  mov rdi, qword ptr [rbp-3320]
+  mov rsi, qword ptr [rbp-3328]
+  cmp rdi, rsi
+  jne .Lelse.main.172
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3336]
+  mov rdx, qword ptr [rbp-3328]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.172
+.Lelse.main.172:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3336]
+  mov r10, qword ptr [rbp-3320]
+  mov rcx, qword ptr [rbp-3328]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.172:
+  mov qword ptr [rbp-3288], 16
+  mov qword ptr [rbp-3296], 16
+  lea rsi, [rip+.L.data.main.144]
+  mov qword ptr [rbp-3304], rsi
+  mov rdi, qword ptr [rbp-3288]
+  mov rsi, qword ptr [rbp-3296]
+  cmp rdi, rsi
+  jne .Lelse.main.173
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3304]
+  mov rdx, qword ptr [rbp-3296]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.173
+.Lelse.main.173:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3304]
+  mov r10, qword ptr [rbp-3288]
+  mov rcx, qword ptr [rbp-3296]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.173:
+  mov qword ptr [rbp-3256], 1
+  mov byte ptr [rbp-8980], 1
+  movsx rsi, byte ptr [rbp-8980]
+  mov qword ptr [rbp-3264], rsi
+  lea rsi, [rip+.L.data.main.145]
+  mov qword ptr [rbp-3272], rsi
+  mov rdi, qword ptr [rbp-3256]
+  mov rsi, qword ptr [rbp-3264]
+  cmp rdi, rsi
+  jne .Lelse.main.174
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3272]
+  mov rdx, qword ptr [rbp-3264]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.174
+.Lelse.main.174:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3272]
+  mov r10, qword ptr [rbp-3256]
+  mov rcx, qword ptr [rbp-3264]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.174:
+  mov qword ptr [rbp-3224], 1
+  mov byte ptr [rbp-8979], 1
+  mov byte ptr [rbp-8978], 2
+  movsx rsi, byte ptr [rbp-8979]
+  mov qword ptr [rbp-3232], rsi
+  lea rsi, [rip+.L.data.main.146]
+  mov qword ptr [rbp-3240], rsi
+  mov rdi, qword ptr [rbp-3224]
+  mov rsi, qword ptr [rbp-3232]
+  cmp rdi, rsi
+  jne .Lelse.main.175
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3240]
+  mov rdx, qword ptr [rbp-3232]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.175
+.Lelse.main.175:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3240]
+  mov r10, qword ptr [rbp-3224]
+  mov rcx, qword ptr [rbp-3232]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.175:
+  mov qword ptr [rbp-3192], 2
+  mov byte ptr [rbp-8977], 1
+  mov byte ptr [rbp-8976], 2
+  movsx rsi, byte ptr [rbp-8976]
+  mov qword ptr [rbp-3200], rsi
+  lea rsi, [rip+.L.data.main.147]
+  mov qword ptr [rbp-3208], rsi
+  mov rdi, qword ptr [rbp-3192]
+  mov rsi, qword ptr [rbp-3200]
+  cmp rdi, rsi
+  jne .Lelse.main.176
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3208]
+  mov rdx, qword ptr [rbp-3200]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.176
+.Lelse.main.176:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3208]
+  mov r10, qword ptr [rbp-3192]
+  mov rcx, qword ptr [rbp-3200]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.176:
+  mov qword ptr [rbp-3160], 1
+  mov qword ptr [rbp-3168], 1
+  lea rsi, [rip+.L.data.main.148]
+  mov qword ptr [rbp-3176], rsi
+  mov rdi, qword ptr [rbp-3160]
+  mov rsi, qword ptr [rbp-3168]
+  cmp rdi, rsi
+  jne .Lelse.main.177
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3176]
+  mov rdx, qword ptr [rbp-3168]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.177
+.Lelse.main.177:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3176]
+  mov r10, qword ptr [rbp-3160]
+  mov rcx, qword ptr [rbp-3168]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.177:
+  mov qword ptr [rbp-3128], 10
+  mov qword ptr [rbp-3136], 10
+  lea rsi, [rip+.L.data.main.149]
+  mov qword ptr [rbp-3144], rsi
+  mov rdi, qword ptr [rbp-3128]
+  mov rsi, qword ptr [rbp-3136]
+  cmp rdi, rsi
+  jne .Lelse.main.178
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3144]
+  mov rdx, qword ptr [rbp-3136]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.178
+.Lelse.main.178:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3144]
+  mov r10, qword ptr [rbp-3128]
+  mov rcx, qword ptr [rbp-3136]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.178:
+  mov qword ptr [rbp-3080], 1
+  lea rdi, [rbp-3088]
+  mov byte ptr [rbp-3105], 7
+  mov byte ptr [rbp-3106], 3
+  mov byte ptr [rbp-3107], 3
+  lea rsi, [rbp-3104]
+  movsx r10, byte ptr [rbp-3105]
+  movsx r11, byte ptr [rbp-3106]
+  sub r10, r11
+  movsx r11, byte ptr [rbp-3107]
+  sub r10, r11
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-3104]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.150]
+  mov qword ptr [rbp-3096], rsi
+  mov rdi, qword ptr [rbp-3080]
+  mov rsi, qword ptr [rbp-3088]
+  cmp rdi, rsi
+  jne .Lelse.main.179
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3096]
+  mov rdx, qword ptr [rbp-3088]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.179
+.Lelse.main.179:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3096]
+  mov r10, qword ptr [rbp-3080]
+  mov rcx, qword ptr [rbp-3088]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.179:
+  mov qword ptr [rbp-3048], 97
+  movsx rsi, byte ptr [rip+.L.data.main.151]
+  mov qword ptr [rbp-3056], rsi
+  lea rsi, [rip+.L.data.main.152]
+  mov qword ptr [rbp-3064], rsi
+  mov rdi, qword ptr [rbp-3048]
+  mov rsi, qword ptr [rbp-3056]
+  cmp rdi, rsi
+  jne .Lelse.main.180
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3064]
+  mov rdx, qword ptr [rbp-3056]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.180
+.Lelse.main.180:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3064]
+  mov r10, qword ptr [rbp-3048]
+  mov rcx, qword ptr [rbp-3056]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.180:
+  mov qword ptr [rbp-3016], 98
+  movsx rsi, byte ptr [rip+.L.data.main.153+1]
+  mov qword ptr [rbp-3024], rsi
+  lea rsi, [rip+.L.data.main.154]
+  mov qword ptr [rbp-3032], rsi
+  mov rdi, qword ptr [rbp-3016]
+  mov rsi, qword ptr [rbp-3024]
+  cmp rdi, rsi
+  jne .Lelse.main.181
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3032]
+  mov rdx, qword ptr [rbp-3024]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.181
+.Lelse.main.181:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3032]
+  mov r10, qword ptr [rbp-3016]
+  mov rcx, qword ptr [rbp-3024]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.181:
+  mov qword ptr [rbp-2984], 99
+  movsx rsi, byte ptr [rip+.L.data.main.155+2]
+  mov qword ptr [rbp-2992], rsi
+  lea rsi, [rip+.L.data.main.156]
+  mov qword ptr [rbp-3000], rsi
+  mov rdi, qword ptr [rbp-2984]
+  mov rsi, qword ptr [rbp-2992]
+  cmp rdi, rsi
+  jne .Lelse.main.182
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-3000]
+  mov rdx, qword ptr [rbp-2992]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.182
+.Lelse.main.182:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-3000]
+  mov r10, qword ptr [rbp-2984]
+  mov rcx, qword ptr [rbp-2992]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.182:
+  mov qword ptr [rbp-2952], 0
+  movsx rsi, byte ptr [rip+.L.data.main.157+3]
+  mov qword ptr [rbp-2960], rsi
+  lea rsi, [rip+.L.data.main.158]
+  mov qword ptr [rbp-2968], rsi
+  mov rdi, qword ptr [rbp-2952]
+  mov rsi, qword ptr [rbp-2960]
+  cmp rdi, rsi
+  jne .Lelse.main.183
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2968]
+  mov rdx, qword ptr [rbp-2960]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.183
+.Lelse.main.183:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2968]
+  mov r10, qword ptr [rbp-2952]
+  mov rcx, qword ptr [rbp-2960]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.183:
+  mov qword ptr [rbp-2920], 4
+  mov qword ptr [rbp-2928], 4
+  lea rsi, [rip+.L.data.main.160]
+  mov qword ptr [rbp-2936], rsi
+  mov rdi, qword ptr [rbp-2920]
+  mov rsi, qword ptr [rbp-2928]
+  cmp rdi, rsi
+  jne .Lelse.main.184
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2936]
+  mov rdx, qword ptr [rbp-2928]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.184
+.Lelse.main.184:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2936]
+  mov r10, qword ptr [rbp-2920]
+  mov rcx, qword ptr [rbp-2928]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.184:
+  mov qword ptr [rbp-2888], 7
+  movsx rsi, byte ptr [rip+.L.data.main.161]
+  mov qword ptr [rbp-2896], rsi
+  lea rsi, [rip+.L.data.main.162]
+  mov qword ptr [rbp-2904], rsi
+  mov rdi, qword ptr [rbp-2888]
+  mov rsi, qword ptr [rbp-2896]
+  cmp rdi, rsi
+  jne .Lelse.main.185
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2904]
+  mov rdx, qword ptr [rbp-2896]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.185
+.Lelse.main.185:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2904]
+  mov r10, qword ptr [rbp-2888]
+  mov rcx, qword ptr [rbp-2896]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.185:
+  mov qword ptr [rbp-2856], 8
+  movsx rsi, byte ptr [rip+.L.data.main.163]
+  mov qword ptr [rbp-2864], rsi
+  lea rsi, [rip+.L.data.main.164]
+  mov qword ptr [rbp-2872], rsi
+  mov rdi, qword ptr [rbp-2856]
+  mov rsi, qword ptr [rbp-2864]
+  cmp rdi, rsi
+  jne .Lelse.main.186
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2872]
+  mov rdx, qword ptr [rbp-2864]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.186
+.Lelse.main.186:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2872]
+  mov r10, qword ptr [rbp-2856]
+  mov rcx, qword ptr [rbp-2864]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.186:
+  mov qword ptr [rbp-2824], 9
+  movsx rsi, byte ptr [rip+.L.data.main.165]
+  mov qword ptr [rbp-2832], rsi
+  lea rsi, [rip+.L.data.main.166]
+  mov qword ptr [rbp-2840], rsi
+  mov rdi, qword ptr [rbp-2824]
+  mov rsi, qword ptr [rbp-2832]
+  cmp rdi, rsi
+  jne .Lelse.main.187
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2840]
+  mov rdx, qword ptr [rbp-2832]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.187
+.Lelse.main.187:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2840]
+  mov r10, qword ptr [rbp-2824]
+  mov rcx, qword ptr [rbp-2832]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.187:
+  mov qword ptr [rbp-2792], 10
+  movsx rsi, byte ptr [rip+.L.data.main.167]
+  mov qword ptr [rbp-2800], rsi
+  lea rsi, [rip+.L.data.main.168]
+  mov qword ptr [rbp-2808], rsi
+  mov rdi, qword ptr [rbp-2792]
+  mov rsi, qword ptr [rbp-2800]
+  cmp rdi, rsi
+  jne .Lelse.main.188
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2808]
+  mov rdx, qword ptr [rbp-2800]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.188
+.Lelse.main.188:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2808]
+  mov r10, qword ptr [rbp-2792]
+  mov rcx, qword ptr [rbp-2800]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.188:
+  mov qword ptr [rbp-2760], 11
+  movsx rsi, byte ptr [rip+.L.data.main.169]
+  mov qword ptr [rbp-2768], rsi
+  lea rsi, [rip+.L.data.main.170]
+  mov qword ptr [rbp-2776], rsi
+  mov rdi, qword ptr [rbp-2760]
+  mov rsi, qword ptr [rbp-2768]
+  cmp rdi, rsi
+  jne .Lelse.main.189
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2776]
+  mov rdx, qword ptr [rbp-2768]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.189
+.Lelse.main.189:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2776]
+  mov r10, qword ptr [rbp-2760]
+  mov rcx, qword ptr [rbp-2768]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.189:
+  mov qword ptr [rbp-2728], 12
+  movsx rsi, byte ptr [rip+.L.data.main.171]
+  mov qword ptr [rbp-2736], rsi
+  lea rsi, [rip+.L.data.main.172]
+  mov qword ptr [rbp-2744], rsi
+  mov rdi, qword ptr [rbp-2728]
+  mov rsi, qword ptr [rbp-2736]
+  cmp rdi, rsi
+  jne .Lelse.main.190
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2744]
+  mov rdx, qword ptr [rbp-2736]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.190
+.Lelse.main.190:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2744]
+  mov r10, qword ptr [rbp-2728]
+  mov rcx, qword ptr [rbp-2736]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.190:
+  mov qword ptr [rbp-2696], 13
+  movsx rsi, byte ptr [rip+.L.data.main.173]
+  mov qword ptr [rbp-2704], rsi
+  lea rsi, [rip+.L.data.main.174]
+  mov qword ptr [rbp-2712], rsi
+  mov rdi, qword ptr [rbp-2696]
+  mov rsi, qword ptr [rbp-2704]
+  cmp rdi, rsi
+  jne .Lelse.main.191
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2712]
+  mov rdx, qword ptr [rbp-2704]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.191
+.Lelse.main.191:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2712]
+  mov r10, qword ptr [rbp-2696]
+  mov rcx, qword ptr [rbp-2704]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.191:
+  mov qword ptr [rbp-2664], 27
+  movsx rsi, byte ptr [rip+.L.data.main.175]
+  mov qword ptr [rbp-2672], rsi
+  lea rsi, [rip+.L.data.main.176]
+  mov qword ptr [rbp-2680], rsi
+  mov rdi, qword ptr [rbp-2664]
+  mov rsi, qword ptr [rbp-2672]
+  cmp rdi, rsi
+  jne .Lelse.main.192
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2680]
+  mov rdx, qword ptr [rbp-2672]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.192
+.Lelse.main.192:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2680]
+  mov r10, qword ptr [rbp-2664]
+  mov rcx, qword ptr [rbp-2672]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.192:
+  mov qword ptr [rbp-2632], 0
+  movsx rsi, byte ptr [rip+.L.data.main.177]
+  mov qword ptr [rbp-2640], rsi
+  lea rsi, [rip+.L.data.main.178]
+  mov qword ptr [rbp-2648], rsi
+  mov rdi, qword ptr [rbp-2632]
+  mov rsi, qword ptr [rbp-2640]
+  cmp rdi, rsi
+  jne .Lelse.main.193
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2648]
+  mov rdx, qword ptr [rbp-2640]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.193
+.Lelse.main.193:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2648]
+  mov r10, qword ptr [rbp-2632]
+  mov rcx, qword ptr [rbp-2640]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.193:
+  mov qword ptr [rbp-2600], 106
+  movsx rsi, byte ptr [rip+.L.data.main.179]
+  mov qword ptr [rbp-2608], rsi
+  lea rsi, [rip+.L.data.main.180]
+  mov qword ptr [rbp-2616], rsi
+  mov rdi, qword ptr [rbp-2600]
+  mov rsi, qword ptr [rbp-2608]
+  cmp rdi, rsi
+  jne .Lelse.main.194
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2616]
+  mov rdx, qword ptr [rbp-2608]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.194
+.Lelse.main.194:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2616]
+  mov r10, qword ptr [rbp-2600]
+  mov rcx, qword ptr [rbp-2608]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.194:
+  mov qword ptr [rbp-2568], 107
+  movsx rsi, byte ptr [rip+.L.data.main.181]
+  mov qword ptr [rbp-2576], rsi
+  lea rsi, [rip+.L.data.main.182]
+  mov qword ptr [rbp-2584], rsi
+  mov rdi, qword ptr [rbp-2568]
+  mov rsi, qword ptr [rbp-2576]
+  cmp rdi, rsi
+  jne .Lelse.main.195
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2584]
+  mov rdx, qword ptr [rbp-2576]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.195
+.Lelse.main.195:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2584]
+  mov r10, qword ptr [rbp-2568]
+  mov rcx, qword ptr [rbp-2576]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.195:
+  mov qword ptr [rbp-2536], 108
+  movsx rsi, byte ptr [rip+.L.data.main.183]
+  mov qword ptr [rbp-2544], rsi
+  lea rsi, [rip+.L.data.main.184]
+  mov qword ptr [rbp-2552], rsi
+  mov rdi, qword ptr [rbp-2536]
+  mov rsi, qword ptr [rbp-2544]
+  cmp rdi, rsi
+  jne .Lelse.main.196
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2552]
+  mov rdx, qword ptr [rbp-2544]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.196
+.Lelse.main.196:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2552]
+  mov r10, qword ptr [rbp-2536]
+  mov rcx, qword ptr [rbp-2544]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.196:
+  mov qword ptr [rbp-2504], 2
+  mov dword ptr [rbp-8964], 2
+  mov dword ptr [rbp-8960], 3
+  movsxd rsi, dword ptr [rbp-8964]
+  mov qword ptr [rbp-2512], rsi
+  lea rsi, [rip+.L.data.main.185]
+  mov qword ptr [rbp-2520], rsi
+  mov rdi, qword ptr [rbp-2504]
+  mov rsi, qword ptr [rbp-2512]
+  cmp rdi, rsi
+  jne .Lelse.main.197
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2520]
+  mov rdx, qword ptr [rbp-2512]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.197
+.Lelse.main.197:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2520]
+  mov r10, qword ptr [rbp-2504]
+  mov rcx, qword ptr [rbp-2512]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.197:
+  mov qword ptr [rbp-2472], 2
+  lea rdi, [rbp-2480]
+  mov dword ptr [rbp-8956], 2
+  mov dword ptr [rbp-8952], 3
+  mov dword ptr [rbp-8948], 4
+  movsxd rsi, dword ptr [rbp-8956]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.186]
+  mov qword ptr [rbp-2488], rsi
+  mov rdi, qword ptr [rbp-2472]
+  mov rsi, qword ptr [rbp-2480]
+  cmp rdi, rsi
+  jne .Lelse.main.198
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2488]
+  mov rdx, qword ptr [rbp-2480]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.198
+.Lelse.main.198:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2488]
+  mov r10, qword ptr [rbp-2472]
+  mov rcx, qword ptr [rbp-2480]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.198:
+  mov qword ptr [rbp-2440], 3
+  mov dword ptr [rbp-8944], 2
+  mov dword ptr [rbp-8944], 3
+  movsxd rsi, dword ptr [rbp-8944]
+  mov qword ptr [rbp-2448], rsi
+  lea rsi, [rip+.L.data.main.187]
+  mov qword ptr [rbp-2456], rsi
+  mov rdi, qword ptr [rbp-2440]
+  mov rsi, qword ptr [rbp-2448]
+  cmp rdi, rsi
+  jne .Lelse.main.199
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2456]
+  mov rdx, qword ptr [rbp-2448]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.199
+.Lelse.main.199:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2456]
+  mov r10, qword ptr [rbp-2440]
+  mov rcx, qword ptr [rbp-2448]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.199:
+  mov qword ptr [rbp-2408], 1
+  mov dword ptr [rbp-8940], 1
+  mov dword ptr [rbp-8936], 2
+  movsxd rsi, dword ptr [rbp-8940]
+  mov qword ptr [rbp-2416], rsi
+  lea rsi, [rip+.L.data.main.188]
+  mov qword ptr [rbp-2424], rsi
+  mov rdi, qword ptr [rbp-2408]
+  mov rsi, qword ptr [rbp-2416]
+  cmp rdi, rsi
+  jne .Lelse.main.200
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2424]
+  mov rdx, qword ptr [rbp-2416]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.200
+.Lelse.main.200:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2424]
+  mov r10, qword ptr [rbp-2408]
+  mov rcx, qword ptr [rbp-2416]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.200:
+  mov qword ptr [rbp-2376], 2
+  mov dword ptr [rbp-8932], 1
+  mov dword ptr [rbp-8928], 2
+  movsxd rsi, dword ptr [rbp-8928]
+  mov qword ptr [rbp-2384], rsi
+  lea rsi, [rip+.L.data.main.189]
+  mov qword ptr [rbp-2392], rsi
+  mov rdi, qword ptr [rbp-2376]
+  mov rsi, qword ptr [rbp-2384]
+  cmp rdi, rsi
+  jne .Lelse.main.201
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2392]
+  mov rdx, qword ptr [rbp-2384]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.201
+.Lelse.main.201:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2392]
+  mov r10, qword ptr [rbp-2376]
+  mov rcx, qword ptr [rbp-2384]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.201:
+  mov qword ptr [rbp-2344], 1
+  lea rdi, [rbp-2352]
+  mov byte ptr [rbp-8924], 1
+  mov dword ptr [rbp-8920], 2
+  mov byte ptr [rbp-8916], 3
+  movsx rsi, byte ptr [rbp-8924]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.190]
+  mov qword ptr [rbp-2360], rsi
+  mov rdi, qword ptr [rbp-2344]
+  mov rsi, qword ptr [rbp-2352]
+  cmp rdi, rsi
+  jne .Lelse.main.202
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2360]
+  mov rdx, qword ptr [rbp-2352]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.202
+.Lelse.main.202:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2360]
+  mov r10, qword ptr [rbp-2344]
+  mov rcx, qword ptr [rbp-2352]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.202:
+  mov qword ptr [rbp-2312], 2
+  lea rdi, [rbp-2320]
+  mov dword ptr [rbp-8908], 1
+  mov dword ptr [rbp-8908], 2
+  mov byte ptr [rbp-8904], 3
+  movsxd rsi, dword ptr [rbp-8908]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.191]
+  mov qword ptr [rbp-2328], rsi
+  mov rdi, qword ptr [rbp-2312]
+  mov rsi, qword ptr [rbp-2320]
+  cmp rdi, rsi
+  jne .Lelse.main.203
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2328]
+  mov rdx, qword ptr [rbp-2320]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.203
+.Lelse.main.203:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2328]
+  mov r10, qword ptr [rbp-2312]
+  mov rcx, qword ptr [rbp-2320]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.203:
+  mov qword ptr [rbp-2280], 3
+  lea rdi, [rbp-2288]
+  mov byte ptr [rbp-8900], 1
+  mov dword ptr [rbp-8896], 2
+  mov byte ptr [rbp-8892], 3
+  movsx rsi, byte ptr [rbp-8892]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.192]
+  mov qword ptr [rbp-2296], rsi
+  mov rdi, qword ptr [rbp-2280]
+  mov rsi, qword ptr [rbp-2288]
+  cmp rdi, rsi
+  jne .Lelse.main.204
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2296]
+  mov rdx, qword ptr [rbp-2288]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.204
+.Lelse.main.204:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2296]
+  mov r10, qword ptr [rbp-2280]
+  mov rcx, qword ptr [rbp-2288]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.204:
+  mov qword ptr [rbp-2248], 0
+  lea rdi, [rbp-2256]
+  lea r10, [rbp-8888]
+  mov qword ptr [rbp-8864], r10
+  mov rsi, r10
+  mov dword ptr [rsi], 0
+  movsxd rsi, dword ptr [rbp-8888]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.193]
+  mov qword ptr [rbp-2264], rsi
+  mov rdi, qword ptr [rbp-2248]
+  mov rsi, qword ptr [rbp-2256]
+  cmp rdi, rsi
+  jne .Lelse.main.205
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2264]
+  mov rdx, qword ptr [rbp-2256]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.205
+.Lelse.main.205:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2264]
+  mov r10, qword ptr [rbp-2248]
+  mov rcx, qword ptr [rbp-2256]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.205:
+  mov qword ptr [rbp-2216], 1
+  lea rdi, [rbp-2224]
+  lea r10, [rbp-8856]
+  mov qword ptr [rbp-8832], r10
+  mov rsi, r10
+  add rsi, 4
+  mov dword ptr [rsi], 1
+  movsxd rsi, dword ptr [rbp-8852]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.194]
+  mov qword ptr [rbp-2232], rsi
+  mov rdi, qword ptr [rbp-2216]
+  mov rsi, qword ptr [rbp-2224]
+  cmp rdi, rsi
+  jne .Lelse.main.206
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2232]
+  mov rdx, qword ptr [rbp-2224]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.206
+.Lelse.main.206:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2232]
+  mov r10, qword ptr [rbp-2216]
+  mov rcx, qword ptr [rbp-2224]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.206:
+  mov qword ptr [rbp-2184], 2
+  lea rdi, [rbp-2192]
+  lea r10, [rbp-8824]
+  mov qword ptr [rbp-8800], r10
+  mov rsi, r10
+  add rsi, 8
+  mov dword ptr [rsi], 2
+  movsxd rsi, dword ptr [rbp-8816]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.195]
+  mov qword ptr [rbp-2200], rsi
+  mov rdi, qword ptr [rbp-2184]
+  mov rsi, qword ptr [rbp-2192]
+  cmp rdi, rsi
+  jne .Lelse.main.207
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2200]
+  mov rdx, qword ptr [rbp-2192]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.207
+.Lelse.main.207:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2200]
+  mov r10, qword ptr [rbp-2184]
+  mov rcx, qword ptr [rbp-2192]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.207:
+  mov qword ptr [rbp-2152], 3
+  lea rdi, [rbp-2160]
+  lea r10, [rbp-8792]
+  mov qword ptr [rbp-8768], r10
+  mov rsi, r10
+  add rsi, 12
+  mov dword ptr [rsi], 3
+  movsxd rsi, dword ptr [rbp-8780]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.196]
+  mov qword ptr [rbp-2168], rsi
+  mov rdi, qword ptr [rbp-2152]
+  mov rsi, qword ptr [rbp-2160]
+  cmp rdi, rsi
+  jne .Lelse.main.208
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2168]
+  mov rdx, qword ptr [rbp-2160]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.208
+.Lelse.main.208:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2168]
+  mov r10, qword ptr [rbp-2152]
+  mov rcx, qword ptr [rbp-2160]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.208:
+  mov qword ptr [rbp-2120], 6
+  lea rdi, [rbp-2128]
+  lea r10, [rbp-8760]
+  mov qword ptr [rbp-8728], r10
+  mov dword ptr [rbp-8760], 6
+  mov rsi, qword ptr [rbp-8728]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.197]
+  mov qword ptr [rbp-2136], rsi
+  mov rdi, qword ptr [rbp-2120]
+  mov rsi, qword ptr [rbp-2128]
+  cmp rdi, rsi
+  jne .Lelse.main.209
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2136]
+  mov rdx, qword ptr [rbp-2128]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.209
+.Lelse.main.209:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2136]
+  mov r10, qword ptr [rbp-2120]
+  mov rcx, qword ptr [rbp-2128]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.209:
+  mov qword ptr [rbp-2088], 7
+  lea rdi, [rbp-2096]
+  lea r10, [rbp-8720]
+  mov qword ptr [rbp-8688], r10
+  mov dword ptr [rbp-8708], 7
+  mov rsi, qword ptr [rbp-8688]
+  add rsi, 12
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.198]
+  mov qword ptr [rbp-2104], rsi
+  mov rdi, qword ptr [rbp-2088]
+  mov rsi, qword ptr [rbp-2096]
+  cmp rdi, rsi
+  jne .Lelse.main.210
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2104]
+  mov rdx, qword ptr [rbp-2096]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.210
+.Lelse.main.210:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2104]
+  mov r10, qword ptr [rbp-2088]
+  mov rcx, qword ptr [rbp-2096]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.210:
+  mov qword ptr [rbp-2056], 6
+  mov dword ptr [rbp-8680], 6
+  movsxd rsi, dword ptr [rbp-8680]
+  mov qword ptr [rbp-2064], rsi
+  lea rsi, [rip+.L.data.main.199]
+  mov qword ptr [rbp-2072], rsi
+  mov rdi, qword ptr [rbp-2056]
+  mov rsi, qword ptr [rbp-2064]
+  cmp rdi, rsi
+  jne .Lelse.main.211
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2072]
+  mov rdx, qword ptr [rbp-2064]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.211
+.Lelse.main.211:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2072]
+  mov r10, qword ptr [rbp-2056]
+  mov rcx, qword ptr [rbp-2064]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.211:
+  mov qword ptr [rbp-2024], 4
+  mov qword ptr [rbp-2032], 4
+  lea rsi, [rip+.L.data.main.200]
+  mov qword ptr [rbp-2040], rsi
+  mov rdi, qword ptr [rbp-2024]
+  mov rsi, qword ptr [rbp-2032]
+  cmp rdi, rsi
+  jne .Lelse.main.212
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2040]
+  mov rdx, qword ptr [rbp-2032]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.212
+.Lelse.main.212:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2040]
+  mov r10, qword ptr [rbp-2024]
+  mov rcx, qword ptr [rbp-2032]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.212:
+  mov qword ptr [rbp-1992], 8
+  mov qword ptr [rbp-2000], 8
+  lea rsi, [rip+.L.data.main.201]
+  mov qword ptr [rbp-2008], rsi
+  mov rdi, qword ptr [rbp-1992]
+  mov rsi, qword ptr [rbp-2000]
+  cmp rdi, rsi
+  jne .Lelse.main.213
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-2008]
+  mov rdx, qword ptr [rbp-2000]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.213
+.Lelse.main.213:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-2008]
+  mov r10, qword ptr [rbp-1992]
+  mov rcx, qword ptr [rbp-2000]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.213:
+  mov qword ptr [rbp-1960], 12
+  mov qword ptr [rbp-1968], 12
+  lea rsi, [rip+.L.data.main.202]
+  mov qword ptr [rbp-1976], rsi
+  mov rdi, qword ptr [rbp-1960]
+  mov rsi, qword ptr [rbp-1968]
+  cmp rdi, rsi
+  jne .Lelse.main.214
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1976]
+  mov rdx, qword ptr [rbp-1968]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.214
+.Lelse.main.214:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1976]
+  mov r10, qword ptr [rbp-1960]
+  mov rcx, qword ptr [rbp-1968]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.214:
+  mov qword ptr [rbp-1928], 16
+  mov qword ptr [rbp-1936], 16
+  lea rsi, [rip+.L.data.main.203]
+  mov qword ptr [rbp-1944], rsi
+  mov rdi, qword ptr [rbp-1928]
+  mov rsi, qword ptr [rbp-1936]
+  cmp rdi, rsi
+  jne .Lelse.main.215
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1944]
+  mov rdx, qword ptr [rbp-1936]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.215
+.Lelse.main.215:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1944]
+  mov r10, qword ptr [rbp-1928]
+  mov rcx, qword ptr [rbp-1936]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.215:
+  mov qword ptr [rbp-1896], 24
+  mov qword ptr [rbp-1904], 24
+  lea rsi, [rip+.L.data.main.204]
+  mov qword ptr [rbp-1912], rsi
+  mov rdi, qword ptr [rbp-1896]
+  mov rsi, qword ptr [rbp-1904]
+  cmp rdi, rsi
+  jne .Lelse.main.216
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1912]
+  mov rdx, qword ptr [rbp-1904]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.216
+.Lelse.main.216:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1912]
+  mov r10, qword ptr [rbp-1896]
+  mov rcx, qword ptr [rbp-1904]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.216:
+  mov qword ptr [rbp-1864], 2
+  mov qword ptr [rbp-1872], 2
+  lea rsi, [rip+.L.data.main.205]
+  mov qword ptr [rbp-1880], rsi
+  mov rdi, qword ptr [rbp-1864]
+  mov rsi, qword ptr [rbp-1872]
+  cmp rdi, rsi
+  jne .Lelse.main.217
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1880]
+  mov rdx, qword ptr [rbp-1872]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.217
+.Lelse.main.217:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1880]
+  mov r10, qword ptr [rbp-1864]
+  mov rcx, qword ptr [rbp-1872]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.217:
+  mov qword ptr [rbp-1832], 8
+  mov qword ptr [rbp-1840], 8
+  lea rsi, [rip+.L.data.main.206]
+  mov qword ptr [rbp-1848], rsi
+  mov rdi, qword ptr [rbp-1832]
+  mov rsi, qword ptr [rbp-1840]
+  cmp rdi, rsi
+  jne .Lelse.main.218
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1848]
+  mov rdx, qword ptr [rbp-1840]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.218
+.Lelse.main.218:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1848]
+  mov r10, qword ptr [rbp-1832]
+  mov rcx, qword ptr [rbp-1840]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.218:
+  mov qword ptr [rbp-1800], 8
+  mov qword ptr [rbp-1808], 8
+  lea rsi, [rip+.L.data.main.207]
+  mov qword ptr [rbp-1816], rsi
+  mov rdi, qword ptr [rbp-1800]
+  mov rsi, qword ptr [rbp-1808]
+  cmp rdi, rsi
+  jne .Lelse.main.219
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1816]
+  mov rdx, qword ptr [rbp-1808]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.219
+.Lelse.main.219:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1816]
+  mov r10, qword ptr [rbp-1800]
+  mov rcx, qword ptr [rbp-1808]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.219:
+  mov qword ptr [rbp-1768], 7
+  lea rdi, [rbp-1776]
+  lea r10, [rbp-8592]
+  mov dword ptr [rbp-8584], r10d
+  lea r10, [rbp-8585]
+  mov dword ptr [rbp-8580], r10d
+  movsxd rsi, r10d
+  movsxd r10, dword ptr [rbp-8584]
+  sub rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.208]
+  mov qword ptr [rbp-1784], rsi
+  mov rdi, qword ptr [rbp-1768]
+  mov rsi, qword ptr [rbp-1776]
+  cmp rdi, rsi
+  jne .Lelse.main.220
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1784]
+  mov rdx, qword ptr [rbp-1776]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.220
+.Lelse.main.220:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1784]
+  mov r10, qword ptr [rbp-1768]
+  mov rcx, qword ptr [rbp-1776]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.220:
+  mov qword ptr [rbp-1736], 1
+  lea rdi, [rbp-1744]
+  lea r10, [rbp-8573]
+  mov dword ptr [rbp-8568], r10d
+  lea r10, [rbp-8572]
+  mov dword ptr [rbp-8564], r10d
+  movsxd rsi, r10d
+  movsxd r10, dword ptr [rbp-8568]
+  sub rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.209]
+  mov qword ptr [rbp-1752], rsi
+  mov rdi, qword ptr [rbp-1736]
+  mov rsi, qword ptr [rbp-1744]
+  cmp rdi, rsi
+  jne .Lelse.main.221
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1752]
+  mov rdx, qword ptr [rbp-1744]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.221
+.Lelse.main.221:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1752]
+  mov r10, qword ptr [rbp-1736]
+  mov rcx, qword ptr [rbp-1744]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.221:
+  mov qword ptr [rbp-1704], 8
+  mov qword ptr [rbp-1712], 8
+  lea rsi, [rip+.L.data.main.210]
+  mov qword ptr [rbp-1720], rsi
+  mov rdi, qword ptr [rbp-1704]
+  mov rsi, qword ptr [rbp-1712]
+  cmp rdi, rsi
+  jne .Lelse.main.222
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1720]
+  mov rdx, qword ptr [rbp-1712]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.222
+.Lelse.main.222:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1720]
+  mov r10, qword ptr [rbp-1704]
+  mov rcx, qword ptr [rbp-1712]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.222:
+  mov qword ptr [rbp-1672], 8
+  mov qword ptr [rbp-1680], 8
+  lea rsi, [rip+.L.data.main.211]
+  mov qword ptr [rbp-1688], rsi
+  mov rdi, qword ptr [rbp-1672]
+  mov rsi, qword ptr [rbp-1680]
+  cmp rdi, rsi
+  jne .Lelse.main.223
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1688]
+  mov rdx, qword ptr [rbp-1680]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.223
+.Lelse.main.223:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1688]
+  mov r10, qword ptr [rbp-1672]
+  mov rcx, qword ptr [rbp-1680]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.223:
+  mov qword ptr [rbp-1640], 2
+  mov qword ptr [rbp-1648], 2
+  lea rsi, [rip+.L.data.main.212]
+  mov qword ptr [rbp-1656], rsi
+  mov rdi, qword ptr [rbp-1640]
+  mov rsi, qword ptr [rbp-1648]
+  cmp rdi, rsi
+  jne .Lelse.main.224
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1656]
+  mov rdx, qword ptr [rbp-1648]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.224
+.Lelse.main.224:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1656]
+  mov r10, qword ptr [rbp-1640]
+  mov rcx, qword ptr [rbp-1648]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.224:
+  mov qword ptr [rbp-1608], 3
+  lea rdi, [rbp-1616]
+  mov dword ptr [rbp-8532], 1
+  mov dword ptr [rbp-8528], 2
+  movsxd rsi, dword ptr [rbp-8532]
+  movsxd r10, dword ptr [rbp-8528]
+  add rsi, r10
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.213]
+  mov qword ptr [rbp-1624], rsi
+  mov rdi, qword ptr [rbp-1608]
+  mov rsi, qword ptr [rbp-1616]
+  cmp rdi, rsi
+  jne .Lelse.main.225
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1624]
+  mov rdx, qword ptr [rbp-1616]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.225
+.Lelse.main.225:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1624]
+  mov r10, qword ptr [rbp-1608]
+  mov rcx, qword ptr [rbp-1616]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.225:
+  mov qword ptr [rbp-1576], 3
+  lea rdi, [rbp-1584]
+  lea r10, [rbp-8521]
+  mov qword ptr [rbp-8520], r10
+  mov byte ptr [rbp-8521], 3
+  mov rsi, qword ptr [rbp-8520]
+  movsx rsi, byte ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.214]
+  mov qword ptr [rbp-1592], rsi
+  mov rdi, qword ptr [rbp-1576]
+  mov rsi, qword ptr [rbp-1584]
+  cmp rdi, rsi
+  jne .Lelse.main.226
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1592]
+  mov rdx, qword ptr [rbp-1584]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.226
+.Lelse.main.226:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1592]
+  mov r10, qword ptr [rbp-1576]
+  mov rcx, qword ptr [rbp-1584]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.226:
+  mov qword ptr [rbp-1544], 3
+  lea rdi, [rbp-1552]
+  lea r10, [rbp-8505]
+  mov qword ptr [rbp-8504], r10
+  mov rsi, r10
+  mov byte ptr [rsi], 3
+  movsx rsi, byte ptr [rbp-8505]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.215]
+  mov qword ptr [rbp-1560], rsi
+  mov rdi, qword ptr [rbp-1544]
+  mov rsi, qword ptr [rbp-1552]
+  cmp rdi, rsi
+  jne .Lelse.main.227
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1560]
+  mov rdx, qword ptr [rbp-1552]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.227
+.Lelse.main.227:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1560]
+  mov r10, qword ptr [rbp-1544]
+  mov rcx, qword ptr [rbp-1552]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.227:
+  mov qword ptr [rbp-1512], 1
+  mov dword ptr [rbp-8496], 1
+  movsxd rsi, dword ptr [rbp-8496]
+  mov qword ptr [rbp-1520], rsi
+  lea rsi, [rip+.L.data.main.216]
+  mov qword ptr [rbp-1528], rsi
+  mov rdi, qword ptr [rbp-1512]
+  mov rsi, qword ptr [rbp-1520]
+  cmp rdi, rsi
+  jne .Lelse.main.228
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1528]
+  mov rdx, qword ptr [rbp-1520]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.228
+.Lelse.main.228:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1528]
+  mov r10, qword ptr [rbp-1512]
+  mov rcx, qword ptr [rbp-1520]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.228:
+  mov qword ptr [rbp-1480], 1
+  mov dword ptr [rbp-8492], 1
+  movsxd rsi, dword ptr [rbp-8492]
+  mov qword ptr [rbp-1488], rsi
+  lea rsi, [rip+.L.data.main.217]
+  mov qword ptr [rbp-1496], rsi
+  mov rdi, qword ptr [rbp-1480]
+  mov rsi, qword ptr [rbp-1488]
+  cmp rdi, rsi
+  jne .Lelse.main.229
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1496]
+  mov rdx, qword ptr [rbp-1488]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.229
+.Lelse.main.229:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1496]
+  mov r10, qword ptr [rbp-1480]
+  mov rcx, qword ptr [rbp-1488]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.229:
+  mov qword ptr [rbp-1448], 1
+  mov dword ptr [rbp-8488], 1
+  movsxd rsi, dword ptr [rbp-8488]
+  mov qword ptr [rbp-1456], rsi
+  lea rsi, [rip+.L.data.main.218]
+  mov qword ptr [rbp-1464], rsi
+  mov rdi, qword ptr [rbp-1448]
+  mov rsi, qword ptr [rbp-1456]
+  cmp rdi, rsi
+  jne .Lelse.main.230
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1464]
+  mov rdx, qword ptr [rbp-1456]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.230
+.Lelse.main.230:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1464]
+  mov r10, qword ptr [rbp-1448]
+  mov rcx, qword ptr [rbp-1456]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.230:
+  mov qword ptr [rbp-1416], 2
+  mov dword ptr [rbp-8484], 2
+  movsxd rsi, dword ptr [rbp-8484]
+  mov qword ptr [rbp-1424], rsi
+  lea rsi, [rip+.L.data.main.219]
+  mov qword ptr [rbp-1432], rsi
+  mov rdi, qword ptr [rbp-1416]
+  mov rsi, qword ptr [rbp-1424]
+  cmp rdi, rsi
+  jne .Lelse.main.231
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1432]
+  mov rdx, qword ptr [rbp-1424]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.231
+.Lelse.main.231:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1432]
+  mov r10, qword ptr [rbp-1416]
+  mov rcx, qword ptr [rbp-1424]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.231:
+  mov qword ptr [rbp-1384], 8
+  mov qword ptr [rbp-1392], 8
+  lea rsi, [rip+.L.data.main.220]
+  mov qword ptr [rbp-1400], rsi
+  mov rdi, qword ptr [rbp-1384]
+  mov rsi, qword ptr [rbp-1392]
+  cmp rdi, rsi
+  jne .Lelse.main.232
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1400]
+  mov rdx, qword ptr [rbp-1392]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.232
+.Lelse.main.232:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1400]
+  mov r10, qword ptr [rbp-1384]
+  mov rcx, qword ptr [rbp-1392]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.232:
+  mov qword ptr [rbp-1352], 8
+  mov qword ptr [rbp-1360], 8
+  lea rsi, [rip+.L.data.main.221]
+  mov qword ptr [rbp-1368], rsi
+  mov rdi, qword ptr [rbp-1352]
+  mov rsi, qword ptr [rbp-1360]
+  cmp rdi, rsi
+  jne .Lelse.main.233
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1368]
+  mov rdx, qword ptr [rbp-1360]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.233
+.Lelse.main.233:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1368]
+  mov r10, qword ptr [rbp-1352]
+  mov rcx, qword ptr [rbp-1360]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.233:
+  mov qword ptr [rbp-1320], 2
+  mov qword ptr [rbp-1328], 2
+  lea rsi, [rip+.L.data.main.222]
+  mov qword ptr [rbp-1336], rsi
+  mov rdi, qword ptr [rbp-1320]
+  mov rsi, qword ptr [rbp-1328]
+  cmp rdi, rsi
+  jne .Lelse.main.234
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1336]
+  mov rdx, qword ptr [rbp-1328]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.234
+.Lelse.main.234:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1336]
+  mov r10, qword ptr [rbp-1320]
+  mov rcx, qword ptr [rbp-1328]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.234:
+  mov qword ptr [rbp-1288], 4
+  mov qword ptr [rbp-1296], 4
+  lea rsi, [rip+.L.data.main.223]
+  mov qword ptr [rbp-1304], rsi
+  mov rdi, qword ptr [rbp-1288]
+  mov rsi, qword ptr [rbp-1296]
+  cmp rdi, rsi
+  jne .Lelse.main.235
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1304]
+  mov rdx, qword ptr [rbp-1296]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.235
+.Lelse.main.235:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1304]
+  mov r10, qword ptr [rbp-1288]
+  mov rcx, qword ptr [rbp-1296]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.235:
+  mov qword ptr [rbp-1256], 8
+  mov qword ptr [rbp-1264], 8
+  lea rsi, [rip+.L.data.main.224]
+  mov qword ptr [rbp-1272], rsi
+  mov rdi, qword ptr [rbp-1256]
+  mov rsi, qword ptr [rbp-1264]
+  cmp rdi, rsi
+  jne .Lelse.main.236
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1272]
+  mov rdx, qword ptr [rbp-1264]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.236
+.Lelse.main.236:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1272]
+  mov r10, qword ptr [rbp-1256]
+  mov rcx, qword ptr [rbp-1264]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.236:
+  mov qword ptr [rbp-1224], 16
+  mov qword ptr [rbp-1232], 16
+  lea rsi, [rip+.L.data.main.225]
+  mov qword ptr [rbp-1240], rsi
+  mov rdi, qword ptr [rbp-1224]
+  mov rsi, qword ptr [rbp-1232]
+  cmp rdi, rsi
+  jne .Lelse.main.237
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1240]
+  mov rdx, qword ptr [rbp-1232]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.237
+.Lelse.main.237:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1240]
+  mov r10, qword ptr [rbp-1224]
+  mov rcx, qword ptr [rbp-1232]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.237:
+  mov qword ptr [rbp-1176], 1
+  lea rdi, [rbp-1184]
+  mov word ptr [rbp-1202], 7
+  mov word ptr [rbp-1204], 3
+  mov word ptr [rbp-1206], 3
+  lea rsi, [rbp-1200]
+  movsx r10, word ptr [rbp-1202]
+  movsx r11, word ptr [rbp-1204]
+  sub r10, r11
+  movsx r11, word ptr [rbp-1206]
+  sub r10, r11
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-1200]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.226]
+  mov qword ptr [rbp-1192], rsi
+  mov rdi, qword ptr [rbp-1176]
+  mov rsi, qword ptr [rbp-1184]
+  cmp rdi, rsi
+  jne .Lelse.main.238
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1192]
+  mov rdx, qword ptr [rbp-1184]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.238
+.Lelse.main.238:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1192]
+  mov r10, qword ptr [rbp-1176]
+  mov rcx, qword ptr [rbp-1184]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.238:
+  mov qword ptr [rbp-1112], 1
+  lea rdi, [rbp-1120]
+  mov qword ptr [rbp-1144], 7
+  mov qword ptr [rbp-1152], 3
+  mov qword ptr [rbp-1160], 3
+  lea rsi, [rbp-1136]
+  mov r10, qword ptr [rbp-1144]
+  mov r11, qword ptr [rbp-1152]
+  sub r10, r11
+  mov r11, qword ptr [rbp-1160]
+  sub r10, r11
+  mov qword ptr [rsi], r10
+  mov rsi, qword ptr [rbp-1136]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.227]
+  mov qword ptr [rbp-1128], rsi
+  mov rdi, qword ptr [rbp-1112]
+  mov rsi, qword ptr [rbp-1120]
+  cmp rdi, rsi
+  jne .Lelse.main.239
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1128]
+  mov rdx, qword ptr [rbp-1120]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.239
+.Lelse.main.239:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1128]
+  mov r10, qword ptr [rbp-1112]
+  mov rcx, qword ptr [rbp-1120]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.239:
+  mov qword ptr [rbp-1080], 24
+  mov qword ptr [rbp-1088], 24
+  lea rsi, [rip+.L.data.main.228]
+  mov qword ptr [rbp-1096], rsi
+  mov rdi, qword ptr [rbp-1080]
+  mov rsi, qword ptr [rbp-1088]
+  cmp rdi, rsi
+  jne .Lelse.main.240
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1096]
+  mov rdx, qword ptr [rbp-1088]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.240
+.Lelse.main.240:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1096]
+  mov r10, qword ptr [rbp-1080]
+  mov rcx, qword ptr [rbp-1088]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.240:
+  mov qword ptr [rbp-1048], 8
+  mov qword ptr [rbp-1056], 8
+  lea rsi, [rip+.L.data.main.229]
+  mov qword ptr [rbp-1064], rsi
+  mov rdi, qword ptr [rbp-1048]
+  mov rsi, qword ptr [rbp-1056]
+  cmp rdi, rsi
+  jne .Lelse.main.241
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1064]
+  mov rdx, qword ptr [rbp-1056]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.241
+.Lelse.main.241:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1064]
+  mov r10, qword ptr [rbp-1048]
+  mov rcx, qword ptr [rbp-1056]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.241:
+  mov qword ptr [rbp-1016], 3
+  lea rdi, [rbp-1024]
+  lea r10, [rbp-8368]
+  mov qword ptr [rbp-8392], r10
+  mov dword ptr [rbp-8368], 3
+  mov rsi, qword ptr [rbp-8392]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.230]
+  mov qword ptr [rbp-1032], rsi
+  mov rdi, qword ptr [rbp-1016]
+  mov rsi, qword ptr [rbp-1024]
+  cmp rdi, rsi
+  jne .Lelse.main.242
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1032]
+  mov rdx, qword ptr [rbp-1024]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.242
+.Lelse.main.242:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1032]
+  mov r10, qword ptr [rbp-1016]
+  mov rcx, qword ptr [rbp-1024]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.242:
+  mov qword ptr [rbp-984], 4
+  lea rdi, [rbp-992]
+  lea r10, [rbp-8364]
+  mov qword ptr [rbp-8352], r10
+  mov rsi, r10
+  mov dword ptr [rsi], 4
+  mov rsi, qword ptr [rbp-8352]
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.231]
+  mov qword ptr [rbp-1000], rsi
+  mov rdi, qword ptr [rbp-984]
+  mov rsi, qword ptr [rbp-992]
+  cmp rdi, rsi
+  jne .Lelse.main.243
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-1000]
+  mov rdx, qword ptr [rbp-992]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.243
+.Lelse.main.243:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-1000]
+  mov r10, qword ptr [rbp-984]
+  mov rcx, qword ptr [rbp-992]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.243:
+  mov qword ptr [rbp-944], 3
+  lea rdi, [rbp-952]
+  lea r10, [rip+g1]
+  mov qword ptr [rbp-968], r10
+  mov rsi, r10
+  movsxd rsi, dword ptr [rsi]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.232]
+  mov qword ptr [rbp-960], rsi
+  mov rdi, qword ptr [rbp-944]
+  mov rsi, qword ptr [rbp-952]
+  cmp rdi, rsi
+  jne .Lelse.main.244
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-960]
+  mov rdx, qword ptr [rbp-952]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.244
+.Lelse.main.244:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-960]
+  mov r10, qword ptr [rbp-944]
+  mov rcx, qword ptr [rbp-952]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.244:
+  mov qword ptr [rbp-912], 0
+  lea rdi, [rbp-920]
+  lea rsi, [rbp-8336]
+  mov r10, 0
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov byte ptr [rsi], r10b
+  movsx rsi, byte ptr [rbp-8336]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.233]
+  mov qword ptr [rbp-928], rsi
+  mov rdi, qword ptr [rbp-912]
+  mov rsi, qword ptr [rbp-920]
+  cmp rdi, rsi
+  jne .Lelse.main.245
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-928]
+  mov rdx, qword ptr [rbp-920]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.245
+.Lelse.main.245:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-928]
+  mov r10, qword ptr [rbp-912]
+  mov rcx, qword ptr [rbp-920]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.245:
+  mov qword ptr [rbp-880], 1
+  lea rdi, [rbp-888]
+  lea rsi, [rbp-8335]
+  mov r10, 1
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov byte ptr [rsi], r10b
+  movsx rsi, byte ptr [rbp-8335]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.234]
+  mov qword ptr [rbp-896], rsi
+  mov rdi, qword ptr [rbp-880]
+  mov rsi, qword ptr [rbp-888]
+  cmp rdi, rsi
+  jne .Lelse.main.246
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-896]
+  mov rdx, qword ptr [rbp-888]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.246
+.Lelse.main.246:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-896]
+  mov r10, qword ptr [rbp-880]
+  mov rcx, qword ptr [rbp-888]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.246:
+  mov qword ptr [rbp-848], 1
+  lea rdi, [rbp-856]
+  lea rsi, [rbp-8334]
+  mov r10, 2
+  cmp r10, 0
+  setne r10b
+  movzx r10, r10b
+  mov byte ptr [rsi], r10b
+  movsx rsi, byte ptr [rbp-8334]
+  mov qword ptr [rdi], rsi
+  lea rsi, [rip+.L.data.main.235]
+  mov qword ptr [rbp-864], rsi
+  mov rdi, qword ptr [rbp-848]
+  mov rsi, qword ptr [rbp-856]
+  cmp rdi, rsi
+  jne .Lelse.main.247
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-864]
+  mov rdx, qword ptr [rbp-856]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.247
+.Lelse.main.247:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-864]
+  mov r10, qword ptr [rbp-848]
+  mov rcx, qword ptr [rbp-856]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.247:
+  mov qword ptr [rbp-816], 1
+  mov qword ptr [rbp-824], 1
+  lea rsi, [rip+.L.data.main.236]
+  mov qword ptr [rbp-832], rsi
+  mov rdi, qword ptr [rbp-816]
+  mov rsi, qword ptr [rbp-824]
+  cmp rdi, rsi
+  jne .Lelse.main.248
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-832]
+  mov rdx, qword ptr [rbp-824]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.248
+.Lelse.main.248:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-832]
+  mov r10, qword ptr [rbp-816]
+  mov rcx, qword ptr [rbp-824]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.248:
+  mov qword ptr [rbp-784], 2
+  mov qword ptr [rbp-792], 2
+  lea rsi, [rip+.L.data.main.237]
+  mov qword ptr [rbp-800], rsi
+  mov rdi, qword ptr [rbp-784]
+  mov rsi, qword ptr [rbp-792]
+  cmp rdi, rsi
+  jne .Lelse.main.249
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-800]
+  mov rdx, qword ptr [rbp-792]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.249
+.Lelse.main.249:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-800]
+  mov r10, qword ptr [rbp-784]
+  mov rcx, qword ptr [rbp-792]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.249:
+  mov qword ptr [rbp-752], 2
+  mov qword ptr [rbp-760], 2
+  lea rsi, [rip+.L.data.main.238]
+  mov qword ptr [rbp-768], rsi
+  mov rdi, qword ptr [rbp-752]
+  mov rsi, qword ptr [rbp-760]
+  cmp rdi, rsi
+  jne .Lelse.main.250
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-768]
+  mov rdx, qword ptr [rbp-760]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.250
+.Lelse.main.250:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-768]
+  mov r10, qword ptr [rbp-752]
+  mov rcx, qword ptr [rbp-760]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.250:
+  mov qword ptr [rbp-720], 4
+  mov qword ptr [rbp-728], 4
+  lea rsi, [rip+.L.data.main.239]
+  mov qword ptr [rbp-736], rsi
+  mov rdi, qword ptr [rbp-720]
+  mov rsi, qword ptr [rbp-728]
+  cmp rdi, rsi
+  jne .Lelse.main.251
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-736]
+  mov rdx, qword ptr [rbp-728]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.251
+.Lelse.main.251:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-736]
+  mov r10, qword ptr [rbp-720]
+  mov rcx, qword ptr [rbp-728]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.251:
+  mov qword ptr [rbp-688], 4
+  mov qword ptr [rbp-696], 4
+  lea rsi, [rip+.L.data.main.240]
+  mov qword ptr [rbp-704], rsi
+  mov rdi, qword ptr [rbp-688]
+  mov rsi, qword ptr [rbp-696]
+  cmp rdi, rsi
+  jne .Lelse.main.252
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-704]
+  mov rdx, qword ptr [rbp-696]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.252
+.Lelse.main.252:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-704]
+  mov r10, qword ptr [rbp-688]
+  mov rcx, qword ptr [rbp-696]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.252:
+  mov qword ptr [rbp-656], 8
+  mov qword ptr [rbp-664], 8
+  lea rsi, [rip+.L.data.main.241]
+  mov qword ptr [rbp-672], rsi
+  mov rdi, qword ptr [rbp-656]
+  mov rsi, qword ptr [rbp-664]
+  cmp rdi, rsi
+  jne .Lelse.main.253
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-672]
+  mov rdx, qword ptr [rbp-664]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.253
+.Lelse.main.253:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-672]
+  mov r10, qword ptr [rbp-656]
+  mov rcx, qword ptr [rbp-664]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.253:
+  mov qword ptr [rbp-624], 8
+  mov qword ptr [rbp-632], 8
+  lea rsi, [rip+.L.data.main.242]
+  mov qword ptr [rbp-640], rsi
+  mov rdi, qword ptr [rbp-624]
+  mov rsi, qword ptr [rbp-632]
+  cmp rdi, rsi
+  jne .Lelse.main.254
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-640]
+  mov rdx, qword ptr [rbp-632]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.254
+.Lelse.main.254:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-640]
+  mov r10, qword ptr [rbp-624]
+  mov rcx, qword ptr [rbp-632]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.254:
+  mov qword ptr [rbp-592], 1
+  mov qword ptr [rbp-600], 1
+  lea rsi, [rip+.L.data.main.243]
+  mov qword ptr [rbp-608], rsi
+  mov rdi, qword ptr [rbp-592]
+  mov rsi, qword ptr [rbp-600]
+  cmp rdi, rsi
+  jne .Lelse.main.255
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-608]
+  mov rdx, qword ptr [rbp-600]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.255
+.Lelse.main.255:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-608]
+  mov r10, qword ptr [rbp-592]
+  mov rcx, qword ptr [rbp-600]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.255:
+  mov qword ptr [rbp-560], 2
+  mov qword ptr [rbp-568], 2
+  lea rsi, [rip+.L.data.main.244]
+  mov qword ptr [rbp-576], rsi
+  mov rdi, qword ptr [rbp-560]
+  mov rsi, qword ptr [rbp-568]
+  cmp rdi, rsi
+  jne .Lelse.main.256
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-576]
+  mov rdx, qword ptr [rbp-568]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.256
+.Lelse.main.256:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-576]
+  mov r10, qword ptr [rbp-560]
+  mov rcx, qword ptr [rbp-568]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.256:
+  mov qword ptr [rbp-528], 2
+  mov qword ptr [rbp-536], 2
+  lea rsi, [rip+.L.data.main.245]
+  mov qword ptr [rbp-544], rsi
+  mov rdi, qword ptr [rbp-528]
+  mov rsi, qword ptr [rbp-536]
+  cmp rdi, rsi
+  jne .Lelse.main.257
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-544]
+  mov rdx, qword ptr [rbp-536]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.257
+.Lelse.main.257:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-544]
+  mov r10, qword ptr [rbp-528]
+  mov rcx, qword ptr [rbp-536]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.257:
+  mov qword ptr [rbp-496], 2
+  mov qword ptr [rbp-504], 2
+  lea rsi, [rip+.L.data.main.246]
+  mov qword ptr [rbp-512], rsi
+  mov rdi, qword ptr [rbp-496]
+  mov rsi, qword ptr [rbp-504]
+  cmp rdi, rsi
+  jne .Lelse.main.258
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-512]
+  mov rdx, qword ptr [rbp-504]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.258
+.Lelse.main.258:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-512]
+  mov r10, qword ptr [rbp-496]
+  mov rcx, qword ptr [rbp-504]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.258:
+  mov qword ptr [rbp-464], 4
+  mov qword ptr [rbp-472], 4
+  lea rsi, [rip+.L.data.main.247]
+  mov qword ptr [rbp-480], rsi
+  mov rdi, qword ptr [rbp-464]
+  mov rsi, qword ptr [rbp-472]
+  cmp rdi, rsi
+  jne .Lelse.main.259
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-480]
+  mov rdx, qword ptr [rbp-472]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.259
+.Lelse.main.259:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-480]
+  mov r10, qword ptr [rbp-464]
+  mov rcx, qword ptr [rbp-472]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.259:
+  mov qword ptr [rbp-432], 8
+  mov qword ptr [rbp-440], 8
+  lea rsi, [rip+.L.data.main.248]
+  mov qword ptr [rbp-448], rsi
+  mov rdi, qword ptr [rbp-432]
+  mov rsi, qword ptr [rbp-440]
+  cmp rdi, rsi
+  jne .Lelse.main.260
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-448]
+  mov rdx, qword ptr [rbp-440]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.260
+.Lelse.main.260:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-448]
+  mov r10, qword ptr [rbp-432]
+  mov rcx, qword ptr [rbp-440]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.260:
+  mov qword ptr [rbp-400], 8
+  mov qword ptr [rbp-408], 8
+  lea rsi, [rip+.L.data.main.249]
+  mov qword ptr [rbp-416], rsi
+  mov rdi, qword ptr [rbp-400]
+  mov rsi, qword ptr [rbp-408]
+  cmp rdi, rsi
+  jne .Lelse.main.261
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-416]
+  mov rdx, qword ptr [rbp-408]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.261
+.Lelse.main.261:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-416]
+  mov r10, qword ptr [rbp-400]
+  mov rcx, qword ptr [rbp-408]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.261:
+  mov qword ptr [rbp-368], 8
+  mov qword ptr [rbp-376], 8
+  lea rsi, [rip+.L.data.main.250]
+  mov qword ptr [rbp-384], rsi
+  mov rdi, qword ptr [rbp-368]
+  mov rsi, qword ptr [rbp-376]
+  cmp rdi, rsi
+  jne .Lelse.main.262
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-384]
+  mov rdx, qword ptr [rbp-376]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.262
+.Lelse.main.262:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-384]
+  mov r10, qword ptr [rbp-368]
+  mov rcx, qword ptr [rbp-376]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.262:
+  mov qword ptr [rbp-336], 8
+  mov qword ptr [rbp-344], 8
+  lea rsi, [rip+.L.data.main.251]
+  mov qword ptr [rbp-352], rsi
+  mov rdi, qword ptr [rbp-336]
+  mov rsi, qword ptr [rbp-344]
+  cmp rdi, rsi
+  jne .Lelse.main.263
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-352]
+  mov rdx, qword ptr [rbp-344]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.263
+.Lelse.main.263:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-352]
+  mov r10, qword ptr [rbp-336]
+  mov rcx, qword ptr [rbp-344]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.263:
+  mov qword ptr [rbp-304], 8
+  mov qword ptr [rbp-312], 8
+  lea rsi, [rip+.L.data.main.252]
+  mov qword ptr [rbp-320], rsi
+  mov rdi, qword ptr [rbp-304]
+  mov rsi, qword ptr [rbp-312]
+  cmp rdi, rsi
+  jne .Lelse.main.264
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-320]
+  mov rdx, qword ptr [rbp-312]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.264
+.Lelse.main.264:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-320]
+  mov r10, qword ptr [rbp-304]
+  mov rcx, qword ptr [rbp-312]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.264:
+  mov qword ptr [rbp-272], 8
+  mov qword ptr [rbp-280], 8
+  lea rsi, [rip+.L.data.main.253]
+  mov qword ptr [rbp-288], rsi
+  mov rdi, qword ptr [rbp-272]
+  mov rsi, qword ptr [rbp-280]
+  cmp rdi, rsi
+  jne .Lelse.main.265
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-288]
+  mov rdx, qword ptr [rbp-280]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.265
+.Lelse.main.265:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-288]
+  mov r10, qword ptr [rbp-272]
+  mov rcx, qword ptr [rbp-280]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.265:
+  mov qword ptr [rbp-240], 8
+  mov qword ptr [rbp-248], 8
+  lea rsi, [rip+.L.data.main.254]
+  mov qword ptr [rbp-256], rsi
+  mov rdi, qword ptr [rbp-240]
+  mov rsi, qword ptr [rbp-248]
+  cmp rdi, rsi
+  jne .Lelse.main.266
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-256]
+  mov rdx, qword ptr [rbp-248]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.266
+.Lelse.main.266:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-256]
+  mov r10, qword ptr [rbp-240]
+  mov rcx, qword ptr [rbp-248]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.266:
+  mov qword ptr [rbp-208], 8
+  mov qword ptr [rbp-216], 8
+  lea rsi, [rip+.L.data.main.255]
+  mov qword ptr [rbp-224], rsi
+  mov rdi, qword ptr [rbp-208]
+  mov rsi, qword ptr [rbp-216]
+  cmp rdi, rsi
+  jne .Lelse.main.267
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-224]
+  mov rdx, qword ptr [rbp-216]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.267
+.Lelse.main.267:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-224]
+  mov r10, qword ptr [rbp-208]
+  mov rcx, qword ptr [rbp-216]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.267:
+  mov qword ptr [rbp-176], 32
+  mov qword ptr [rbp-184], 32
+  lea rsi, [rip+.L.data.main.256]
+  mov qword ptr [rbp-192], rsi
+  mov rdi, qword ptr [rbp-176]
+  mov rsi, qword ptr [rbp-184]
+  cmp rdi, rsi
+  jne .Lelse.main.268
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-192]
+  mov rdx, qword ptr [rbp-184]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.268
+.Lelse.main.268:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-192]
+  mov r10, qword ptr [rbp-176]
+  mov rcx, qword ptr [rbp-184]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.268:
+  mov qword ptr [rbp-144], 16
+  mov qword ptr [rbp-152], 16
+  lea rsi, [rip+.L.data.main.257]
+  mov qword ptr [rbp-160], rsi
+  mov rdi, qword ptr [rbp-144]
+  mov rsi, qword ptr [rbp-152]
+  cmp rdi, rsi
+  jne .Lelse.main.269
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-160]
+  mov rdx, qword ptr [rbp-152]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.269
+.Lelse.main.269:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-160]
+  mov r10, qword ptr [rbp-144]
+  mov rcx, qword ptr [rbp-152]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.269:
+  mov qword ptr [rbp-112], 48
+  mov qword ptr [rbp-120], 48
+  lea rsi, [rip+.L.data.main.258]
+  mov qword ptr [rbp-128], rsi
+  mov rdi, qword ptr [rbp-112]
+  mov rsi, qword ptr [rbp-120]
+  cmp rdi, rsi
+  jne .Lelse.main.270
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-128]
+  mov rdx, qword ptr [rbp-120]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.270
+.Lelse.main.270:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-128]
+  mov r10, qword ptr [rbp-112]
+  mov rcx, qword ptr [rbp-120]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.270:
+  mov qword ptr [rbp-80], 4
+  mov qword ptr [rbp-88], 4
+  lea rsi, [rip+.L.data.main.259]
+  mov qword ptr [rbp-96], rsi
+  mov rdi, qword ptr [rbp-80]
+  mov rsi, qword ptr [rbp-88]
+  cmp rdi, rsi
+  jne .Lelse.main.271
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-96]
+  mov rdx, qword ptr [rbp-88]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.271
+.Lelse.main.271:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-96]
+  mov r10, qword ptr [rbp-80]
+  mov rcx, qword ptr [rbp-88]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.271:
+  movabs rsi, 4294967297
+  mov qword ptr [rbp-48], rsi
+  movabs rsi, 4294967297
+  mov qword ptr [rbp-56], rsi
+  lea rsi, [rip+.L.data.main.260]
+  mov qword ptr [rbp-64], rsi
+  mov rdi, qword ptr [rbp-48]
+  mov rsi, qword ptr [rbp-56]
+  cmp rdi, rsi
+  jne .Lelse.main.272
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-64]
+  mov rdx, qword ptr [rbp-56]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.272
+.Lelse.main.272:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-64]
+  mov r10, qword ptr [rbp-48]
+  mov rcx, qword ptr [rbp-56]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.272:
+  mov qword ptr [rbp-16], 8
+  mov qword ptr [rbp-24], 8
+  lea rsi, [rip+.L.data.main.261]
+  mov qword ptr [rbp-32], rsi
+  mov rdi, qword ptr [rbp-16]
+  mov rsi, qword ptr [rbp-24]
+  cmp rdi, rsi
+  jne .Lelse.main.273
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-32]
+  mov rdx, qword ptr [rbp-24]
+  xor eax, eax
+  call printf
+  jmp .Lend.main.273
+.Lelse.main.273:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-32]
+  mov r10, qword ptr [rbp-16]
+  mov rcx, qword ptr [rbp-24]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.main.273:
+  lea rdi, [rip+.L.data.main.262]
+  xor eax, eax
+  call printf
+  mov rax, 0
+.Lreturn.main:
+  mov rsp, rbp
+  pop rbp
+  ret
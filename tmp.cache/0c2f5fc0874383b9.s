@@ -0,0 +1,22 @@
+.global add6
+add6:
+  mov dword ptr [rsp-24], edi
+  mov dword ptr [rsp-20], esi
+  mov dword ptr [rsp-16], edx
+  mov dword ptr [rsp-12], ecx
+  mov dword ptr [rsp-8], r8d
+  mov dword ptr [rsp-4], r9d
+  movsxd rdi, dword ptr [rsp-24]
+  movsxd rsi, dword ptr [rsp-20]
+  add rdi, rsi
+  movsxd rsi, dword ptr [rsp-16]
+  add rdi, rsi
+  movsxd rsi, dword ptr [rsp-12]
+  add rdi, rsi
+  movsxd rsi, dword ptr [rsp-8]
+  add rdi, rsi
+  movsxd rsi, dword ptr [rsp-4]
+  add rdi, rsi
+  mov rax, rdi
+.Lreturn.add6:
+  ret
@@ -0,0 +1,13 @@
+.global sub_long
+sub_long:
+  mov qword ptr [rsp-24], rdi
+  mov qword ptr [rsp-16], rsi
+  mov qword ptr [rsp-8], rdx
+  mov rdi, qword ptr [rsp-24]
+  mov rsi, qword ptr [rsp-16]
+  sub rdi, rsi
+  mov rsi, qword ptr [rsp-8]
+  sub rdi, rsi
+  mov rax, rdi
+.Lreturn.sub_long:
+  ret
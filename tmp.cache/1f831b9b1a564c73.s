@@ -0,0 +1,11 @@
+.global addx
+addx:
+  mov qword ptr [rsp-16], rdi
+  mov dword ptr [rsp-4], esi
+  mov rdi, qword ptr [rsp-16]
+  movsxd rdi, dword ptr [rdi]
+  movsxd rsi, dword ptr [rsp-4]
+  add rdi, rsi
+  mov rax, rdi
+.Lreturn.addx:
+  ret
@@ -0,0 +1,6 @@
+.global low_byte
+low_byte:
+  mov byte ptr [rsp-1], dil
+  movsx rax, dil
+.Lreturn.low_byte:
+  ret
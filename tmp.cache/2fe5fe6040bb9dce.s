@@ -0,0 +1,34 @@
+.global isqrt
+isqrt:
+  mov dword ptr [rsp-8], edi
+  mov dword ptr [rsp-4], 0
+  movsxd rdi, dword ptr [rsp-4]
+  movsxd rsi, dword ptr [rsp-4]
+  imul rdi, rsi
+  movsxd rsi, dword ptr [rsp-8]
+  cmp rdi, rsi
+  jg .Lend.isqrt.0
+.align 16
+.Lbegin.isqrt.0:
+  movsxd rdi, dword ptr [rsp-4]
+  movsxd rsi, dword ptr [rsp-4]
+  imul rdi, rsi
+  movsxd rsi, dword ptr [rsp-8]
+  cmp rdi, rsi
+  jne .Lend.isqrt.1
+  movsxd rax, dword ptr [rsp-4]
+  jmp .Lreturn.isqrt
+.Lend.isqrt.1:
+  movsxd rsi, dword ptr [rsp-4]
+  add rsi, 1
+  mov dword ptr [rsp-4], esi
+  movsxd rdi, esi
+  movsxd rsi, dword ptr [rsp-4]
+  imul rdi, rsi
+  movsxd rsi, dword ptr [rsp-8]
+  cmp rdi, rsi
+  jle .Lbegin.isqrt.0
+.Lend.isqrt.0:
+  mov rax, -1
+.Lreturn.isqrt:
+  ret
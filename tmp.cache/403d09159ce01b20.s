@@ -0,0 +1,55 @@
+.global clamp2
+clamp2:
+  mov dword ptr [rsp-48], edi
+  movsxd rsi, edi
+  mov dword ptr [rsp-36], esi
+  mov dword ptr [rsp-40], 0
+  mov dword ptr [rsp-44], 10
+  movsxd rdi, dword ptr [rsp-36]
+  movsxd rsi, dword ptr [rsp-40]
+  cmp rdi, rsi
+  jge .Lend.clamp2.0
+  movsxd rsi, dword ptr [rsp-40]
+  mov qword ptr [rsp-32], rsi
+  jmp .Ljoin.clamp2.0
+.Lend.clamp2.0:
+  movsxd rdi, dword ptr [rsp-44]
+  movsxd rsi, dword ptr [rsp-36]
+  cmp rdi, rsi
+  jge .Lend.clamp2.1
+  movsxd rsi, dword ptr [rsp-44]
+  mov qword ptr [rsp-32], rsi
+  jmp .Ljoin.clamp2.0
+.Lend.clamp2.1:
+  movsxd rsi, dword ptr [rsp-36]
+  mov qword ptr [rsp-32], rsi
+.Ljoin.clamp2.0:
+  mov rdi, qword ptr [rsp-32]
+  movsxd r10, dword ptr [rsp-48]
+  mov dword ptr [rsp-12], r10d
+  mov dword ptr [rsp-16], 5
+  mov dword ptr [rsp-20], 7
+  movsxd rsi, dword ptr [rsp-12]
+  movsxd r10, dword ptr [rsp-16]
+  cmp rsi, r10
+  jge .Lend.clamp2.2
+  movsxd r10, dword ptr [rsp-16]
+  mov qword ptr [rsp-8], r10
+  jmp .Ljoin.clamp2.1
+.Lend.clamp2.2:
+  movsxd rsi, dword ptr [rsp-20]
+  movsxd r10, dword ptr [rsp-12]
+  cmp rsi, r10
+  jge .Lend.clamp2.3
+  movsxd r10, dword ptr [rsp-20]
+  mov qword ptr [rsp-8], r10
+  jmp .Ljoin.clamp2.1
+.Lend.clamp2.3:
+  movsxd r10, dword ptr [rsp-12]
+  mov qword ptr [rsp-8], r10
+.Ljoin.clamp2.1:
+  mov rsi, qword ptr [rsp-8]
+  add rdi, rsi
+  mov rax, rdi
+.Lreturn.clamp2:
+  ret
@@ -0,0 +1,17 @@
+.global call_later
+call_later:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov dword ptr [rbp-8], edi
+  movsxd rsi, edi
+  lea rsi, [rsi+rsi*2]
+  mov dword ptr [rbp-4], esi
+  movsxd rdi, esi
+  xor eax, eax
+  call fill_frame
+  movsxd rax, dword ptr [rbp-4]
+.Lreturn.call_later:
+  mov rsp, rbp
+  pop rbp
+  ret
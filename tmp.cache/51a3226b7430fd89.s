@@ -0,0 +1,30 @@
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov dword ptr [rbp-4], edi
+  movsxd rdi, edi
+  cmp rdi, 1
+  jg .Lend.fib.0
+  mov rax, 1
+  jmp .Lreturn.fib
+.Lend.fib.0:
+  movsxd rdi, dword ptr [rbp-4]
+  sub rdi, 1
+  call fib
+  mov rdi, rax
+  push rdi
+  movsxd rdi, dword ptr [rbp-4]
+  sub rdi, 2
+  sub rsp, 8
+  call fib
+  add rsp, 8
+  pop rdi
+  mov rsi, rax
+  add rdi, rsi
+  mov rax, rdi
+.Lreturn.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
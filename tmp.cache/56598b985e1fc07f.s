@@ -0,0 +1,22 @@
+.global clamp
+clamp:
+  mov dword ptr [rsp-12], edi
+  mov dword ptr [rsp-8], esi
+  mov dword ptr [rsp-4], edx
+  movsxd rdi, dword ptr [rsp-12]
+  movsxd rsi, dword ptr [rsp-8]
+  cmp rdi, rsi
+  jge .Lend.clamp.0
+  movsxd rax, dword ptr [rsp-8]
+  jmp .Lreturn.clamp
+.Lend.clamp.0:
+  movsxd rdi, dword ptr [rsp-4]
+  movsxd rsi, dword ptr [rsp-12]
+  cmp rdi, rsi
+  jge .Lend.clamp.1
+  movsxd rax, dword ptr [rsp-4]
+  jmp .Lreturn.clamp
+.Lend.clamp.1:
+  movsxd rax, dword ptr [rsp-12]
+.Lreturn.clamp:
+  ret
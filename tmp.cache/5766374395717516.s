@@ -0,0 +1,13 @@
+.global sub_char
+sub_char:
+  mov byte ptr [rsp-3], dil
+  mov byte ptr [rsp-2], sil
+  mov byte ptr [rsp-1], dl
+  movsx rdi, byte ptr [rsp-3]
+  movsx rsi, byte ptr [rsp-2]
+  sub rdi, rsi
+  movsx rsi, byte ptr [rsp-1]
+  sub rdi, rsi
+  mov rax, rdi
+.Lreturn.sub_char:
+  ret
@@ -0,0 +1,10 @@
+.global sub2
+sub2:
+  mov dword ptr [rsp-8], edi
+  mov dword ptr [rsp-4], esi
+  movsxd rdi, dword ptr [rsp-8]
+  movsxd rsi, dword ptr [rsp-4]
+  sub rdi, rsi
+  mov rax, rdi
+.Lreturn.sub2:
+  ret
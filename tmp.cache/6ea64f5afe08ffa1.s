@@ -0,0 +1,13 @@
+.global run_call_later
+run_call_later:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov dword ptr [rbp-4], edi
+  movsxd rdi, edi
+  xor eax, eax
+  call call_later
+.Lreturn.run_call_later:
+  mov rsp, rbp
+  pop rbp
+  ret
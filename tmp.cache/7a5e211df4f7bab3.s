@@ -0,0 +1,81 @@
+.data
+.L.data.assert.1:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 108
+.byte 100
+.byte 32
+.byte 101
+.byte 120
+.byte 112
+.byte 101
+.byte 99
+.byte 116
+.byte 101
+.byte 100
+.byte 32
+.byte 98
+.byte 117
+.byte 116
+.byte 32
+.byte 103
+.byte 111
+.byte 116
+.byte 32
+.byte 37
+.byte 108
+.byte 100
+.byte 10
+.byte 0
+.L.data.assert.0:
+.byte 37
+.byte 115
+.byte 32
+.byte 61
+.byte 62
+.byte 32
+.byte 37
+.byte 108
+.byte 100
+.byte 10
+.byte 0
+.text
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov qword ptr [rbp-8], rdx
+  mov rdi, qword ptr [rbp-24]
+  mov rsi, qword ptr [rbp-16]
+  cmp rdi, rsi
+  jne .Lelse.assert.0
+  lea rdi, [rip+.L.data.assert.0]
+  mov rsi, qword ptr [rbp-8]
+  mov rdx, qword ptr [rbp-16]
+  xor eax, eax
+  call printf
+  jmp .Lend.assert.0
+.Lelse.assert.0:
+  lea rdi, [rip+.L.data.assert.1]
+  mov rsi, qword ptr [rbp-8]
+  mov r10, qword ptr [rbp-24]
+  mov rcx, qword ptr [rbp-16]
+  mov rdx, r10
+  xor eax, eax
+  call printf
+  mov rdi, 1
+  xor eax, eax
+  call exit
+.Lend.assert.0:
+.Lreturn.assert:
+  mov rsp, rbp
+  pop rbp
+  ret
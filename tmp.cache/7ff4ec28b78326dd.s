@@ -0,0 +1,6 @@
+.global widen
+widen:
+  mov qword ptr [rsp-8], rdi
+  mov rax, rdi
+.Lreturn.widen:
+  ret
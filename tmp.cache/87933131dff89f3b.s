@@ -0,0 +1,9 @@
+.global dead_code
+dead_code:
+  mov dword ptr [rsp-8], edi
+  movsxd rsi, edi
+  shl rsi, 1
+  mov dword ptr [rsp-4], esi
+  movsxd rax, esi
+.Lreturn.dead_code:
+  ret
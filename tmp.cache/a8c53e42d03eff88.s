@@ -0,0 +1,23 @@
+.global sum_down
+sum_down:
+  mov dword ptr [rsp-8], edi
+  mov dword ptr [rsp-4], 0
+.align 16
+.Lbegin.sum_down.0:
+  movsxd rdi, dword ptr [rsp-8]
+  cmp rdi, 1
+  jge .Lend.sum_down.1
+  movsxd rax, dword ptr [rsp-4]
+  jmp .Lreturn.sum_down
+.Lend.sum_down.1:
+  movsxd rsi, dword ptr [rsp-4]
+  movsxd r10, dword ptr [rsp-8]
+  add rsi, r10
+  mov dword ptr [rsp-4], esi
+  movsxd rsi, dword ptr [rsp-8]
+  sub rsi, 1
+  mov dword ptr [rsp-8], esi
+  jmp .Lbegin.sum_down.0
+.Lend.sum_down.0:
+.Lreturn.sum_down:
+  ret
@@ -0,0 +1,5 @@
+.global g1_ptr
+g1_ptr:
+  lea rax, [rip+g1]
+.Lreturn.g1_ptr:
+  ret
@@ -0,0 +1,10 @@
+.global add2
+add2:
+  mov dword ptr [rsp-8], edi
+  mov dword ptr [rsp-4], esi
+  movsxd rdi, dword ptr [rsp-8]
+  movsxd rsi, dword ptr [rsp-4]
+  add rdi, rsi
+  mov rax, rdi
+.Lreturn.add2:
+  ret
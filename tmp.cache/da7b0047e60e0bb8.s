@@ -0,0 +1,13 @@
+.global sub_short
+sub_short:
+  mov word ptr [rsp-6], di
+  mov word ptr [rsp-4], si
+  mov word ptr [rsp-2], dx
+  movsx rdi, word ptr [rsp-6]
+  movsx rsi, word ptr [rsp-4]
+  sub rdi, rsi
+  movsx rsi, word ptr [rsp-2]
+  sub rdi, rsi
+  mov rax, rdi
+.Lreturn.sub_short:
+  ret
@@ -0,0 +1,25 @@
+.global fill_frame
+fill_frame:
+  mov dword ptr [rsp-40], edi
+  mov dword ptr [rsp-4], 0
+  movsxd rdi, dword ptr [rsp-4]
+  cmp rdi, 8
+  jge .Lend.fill_frame.0
+.align 16
+.Lbegin.fill_frame.0:
+  movsxd rsi, dword ptr [rsp-4]
+  lea rdi, [rsp+rsi*4-36]
+  movsxd rsi, dword ptr [rsp-40]
+  movsxd r10, dword ptr [rsp-4]
+  add rsi, r10
+  mov dword ptr [rdi], esi
+  movsxd rsi, dword ptr [rsp-4]
+  add rsi, 1
+  mov dword ptr [rsp-4], esi
+  movsxd rdi, esi
+  cmp rdi, 8
+  jl .Lbegin.fill_frame.0
+.Lend.fill_frame.0:
+  movsxd rax, dword ptr [rsp-36]
+.Lreturn.fill_frame:
+  ret
@@ -1,293 +1,388 @@
-#include "9cc.h"
-
-// the token we focus on
-Token *token;
-
-char *filename;
-char *user_input;
-
-static void verror_at(char *loc, char *fmt, va_list ap) {
-
-    fprintf(stderr, "%s\n", user_input);
-
-    char *line = loc;
-    while(user_input < line && line[-1] != '\n') {
-        line--;
-    }
-
-    char *end = loc;
-    while (*end != '\n') {
-        end++;
-    }
-    int line_num = 1;
-    for (char *p = user_input; p < line; p++) {
-        if (*p == '\n') {
-            line_num++;
-        }
-
-    }
-    int indent = fprintf(stderr, "%s:%d: ", filename, line_num);
-    fprintf(stderr, "%.*s\n", (int)(end-line), line);
-    int pos = loc - line + indent;
-    fprintf(stderr, "%*s", pos, "");
-    fprintf(stderr, "^ ");
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
-}
-
-// Reports an error location and exit.
-void error_at(char *loc, char *fmt, ...) {
-
-    va_list ap;
-    va_start(ap, fmt);
-    verror_at(loc, fmt, ap);
-    exit(1);
-}
-
-// Reports an error location and exit.
-void error_tok(Token *tok, char *fmt, ...) {
-  va_list ap;
-  va_start(ap, fmt);
-  if (tok)
-    verror_at(tok->str, fmt, ap);
-
-  vfprintf(stderr, fmt, ap);
-  fprintf(stderr, "\n");
-  exit(1);
-}
-
-// Returns true if the current token matches a given string.
-Token *peek(char *s) {
-  if (token->kind != TK_RESERVED || strlen(s) != token->len ||
-      memcmp(token->str, s, token->len))
-    return NULL;
-  return token;
-}
-
-// Consumes the current token if it matches a given string.
-Token *consume(char *s) {
-  if (!peek(s))
-    return NULL;
-  Token *t = token;
-  token = token->next;
-  return t;
-}
-
-Token *consume_ident(void) {
-  if (token->kind != TK_IDENT)
-    return NULL;
-  Token *t = token;
-  token = token->next;
-  return t;
-}
-
-// If the next token is the symbol we expect,
-// consumes one token else reports an error.
-void expect(char *op) {
-    if (!peek(op)) {
-        error_tok(token, "next token is expected '%c'", op);
-    }
-    token = token->next;
-}
-
-// If the next token  is a number,
-// consumes one token and return this number else reports an error
-long expect_number(void) {
-    if (token->kind != TK_NUM) {
-        error_tok(token, "next token is expected a number");
-    }
-    long val = token->val;
-    token = token->next;
-    return val;
-}
-
-char *expect_ident(void) {
-    if (token->kind != TK_IDENT) {
-        error_tok(token, "expected an identifier");
-    }
-    char *s = strndup(token->str, token->len);
-    token = token->next;
-    return s;
-}
-
-bool at_eof(void) {
-    return token->kind == TK_EOF;
-}
-
-// creates a new token and connects as the next token of current token
-Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-    Token *tok = calloc(1, sizeof(Token));
-    tok->kind = kind;
-    tok->str = str;
-    tok->len = len;
-    cur->next = tok;
-    return tok;
-}
-
-bool startswith(char *p, char *q) {
-    return memcmp(p, q, strlen(q)) == 0;
-}
-
-bool is_alpha(char c) {
-    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
-}
-
-bool is_alnum(char c) {
-    return is_alpha(c) || ('0' <= c && c <= '9');
-}
-
-char *starts_with_reserved(char *p) {
-    // keyword
-    static char *kw[] = {"return", "if", "else", "while", "for",
-                            "short", "int", "long", "sizeof",
-                            "char", "struct", "typedef", "void",
-                            "_Bool"};
-
-    for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
-        int len = strlen(kw[i]);
-        if (startswith(p, kw[i]) && !is_alnum(p[len])) {
-            return kw[i];
-        }
-    }
-
-        // Multi-letter punctuator
-    static char *ops[] = {"==", "!=", "<=", ">=", "->"};
-
-    for (int i = 0; i < sizeof(ops) / sizeof(*ops); i++) {
-        if (startswith(p, ops[i])) {
-            return ops[i];
-        }
-    }
-
-    return NULL;
-}
-
-char get_escape_char(char c) {
-    switch (c)
-    {
-    case 'a': return '\a';
-    case 'b': return '\b';
-    case 't': return '\t';
-    case 'n': return '\n';
-    case 'v': return '\v';
-    case 'f': return '\f';
-    case 'r': return '\r';
-    case 'e': return 27;
-    case '0': return 0;
-    default: return c;
-    }
-}
-
-Token *read_string_literal(Token *cur, char *start){
-    char *p = start + 1;
-    char buf[1024];
-    int len = 0;
-
-    for (;;) {
-        if (len == sizeof(buf)) {
-            error_at(start, "string literal too large");
-        }
-        if (*p == '\0') {
-            error_at(start, "unclosed string literal");
-        }
-        if (*p == '"') {
-            break;
-        }
-
-        if (*p == '\\') {
-            p++;
-            buf[len++] = get_escape_char(*p++);
-        } else {
-            buf[len++] = *p++;
-        }
-    }
-
-    Token *tok = new_token(TK_STR, cur, start, p - start + 1);
-    tok->contents = malloc(len + 1);
-    memcpy(tok->contents, buf, len);
-    tok->contents[len] = '\0';
-    tok->cont_len = len + 1;
-    return tok;
-}
-
-// tokenize input string and return it
-Token *tokenize(char *p) {
-    Token head;
-    head.next = NULL;
-    Token *cur = &head;
-
-    while (*p) {
-        // skip whitespace
-        if (isspace(*p)) {
-            p++;
-            continue;
-        }
-        // skip comment
-        if (strncmp(p, "//", 2) == 0) {
-            p += 2;
-            while (*p != '\n') {
-                p++;
-            }
-            continue;
-        }
-        // skip block comment
-        if (strncmp(p, "/*", 2) == 0) {
-            char *q = strstr(p + 2, "*/");
-            if (!q) {
-                error_at(p, "comment is not closd");
-            }
-            p = q + 2;
-            continue;
-        }
-
-        char *kw = starts_with_reserved(p);
-        if (kw) {
-            int len = strlen(kw);
-            cur = new_token(TK_RESERVED, cur, p, len);
-            p += len;
-            continue;
-        }
-
-        // Single-letter punctuator
-        if (strchr("+-*/()<>=;{},&[].", *p)) {
-            cur = new_token(TK_RESERVED, cur, p++, 1);
-            continue;
-        }
-
-        // Identifier multi letter
-        // rule 1: the first letter of an identifier does not a number
-        // rule 2: "_" is treated as an alphabet
-        // rule 3: after second letter, we can use alphabet and number
-
-        // check whether the first letter is alphabet
-        if (is_alpha(*p)) {
-            char *q = p++;
-            while (is_alnum(*p)) {
-                p++;
-            }
-            cur = new_token(TK_IDENT, cur, q, p - q);
-            continue;
-        }
-
-        // String literal
-        if (*p == '"') {
-            cur = read_string_literal(cur, p);
-            p += cur->len;
-            continue;
-        }
-
-        // Integer literal
-        if (isdigit(*p)) {
-            cur = new_token(TK_NUM, cur, p, 0);
-            char *q = p;    // remain the head of Integer literal
-            cur->val = strtol(p, &p, 10);
-            cur->len = p - q;   // length of Integer
-            continue;
-        }
-
-        error_at(p, "invalid token");
-    }
-
-    new_token(TK_EOF, cur, p, 0);
-    return head.next;
+#include "9cc.h"
+
+// The token stream is an array terminated by a TK_EOF token, and the
+// parser walks it with an index. Backtracking just saves `pos`.
+Token *tokens;
+int pos;        // index of the token we focus on
+static int num_tokens;
+static int cap_tokens;
+
+StrLit *str_lits;
+static int num_str_lits;
+static int cap_str_lits;
+
+char *filename;
+char *user_input;
+
+static void verror_at(char *loc, char *fmt, va_list ap) {
+
+    fprintf(stderr, "%s\n", user_input);
+
+    char *line = loc;
+    while(user_input < line && line[-1] != '\n') {
+        line--;
+    }
+
+    char *end = loc;
+    while (*end != '\n') {
+        end++;
+    }
+    int line_num = 1;
+    for (char *p = user_input; p < line; p++) {
+        if (*p == '\n') {
+            line_num++;
+        }
+
+    }
+    int indent = fprintf(stderr, "%s:%d: ", filename, line_num);
+    fprintf(stderr, "%.*s\n", (int)(end-line), line);
+    int pos = loc - line + indent;
+    fprintf(stderr, "%*s", pos, "");
+    fprintf(stderr, "^ ");
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+}
+
+// Reports an error location and exit.
+void error_at(char *loc, char *fmt, ...) {
+
+    va_list ap;
+    va_start(ap, fmt);
+    verror_at(loc, fmt, ap);
+    die();
+}
+
+// Reports an error location and exit.
+void error_tok(Token *tok, char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  if (tok)
+    verror_at(tok->str, fmt, ap);
+
+  vfprintf(stderr, fmt, ap);
+  fprintf(stderr, "\n");
+  die();
+}
+
+// Spellings of keywords and punctuators, indexed by Reserved.
+static char *reserved_str[NUM_RESERVED] = {
+    [KW_RETURN] = "return", [KW_IF] = "if", [KW_ELSE] = "else",
+    [KW_WHILE] = "while", [KW_FOR] = "for", [KW_SHORT] = "short",
+    [KW_INT] = "int", [KW_LONG] = "long", [KW_SIZEOF] = "sizeof",
+    [KW_CHAR] = "char", [KW_STRUCT] = "struct", [KW_TYPEDEF] = "typedef",
+    [KW_VOID] = "void", [KW_BOOL] = "_Bool",
+    [PU_EQ] = "==", [PU_NE] = "!=", [PU_LE] = "<=", [PU_GE] = ">=",
+    [PU_ARROW] = "->", [PU_PLUS] = "+", [PU_MINUS] = "-", [PU_STAR] = "*",
+    [PU_SLASH] = "/", [PU_LPAREN] = "(", [PU_RPAREN] = ")", [PU_LT] = "<",
+    [PU_GT] = ">", [PU_ASSIGN] = "=", [PU_SEMI] = ";", [PU_LBRACE] = "{",
+    [PU_RBRACE] = "}", [PU_COMMA] = ",", [PU_AMP] = "&", [PU_LBRACKET] = "[",
+    [PU_RBRACKET] = "]", [PU_DOT] = ".",
+};
+
+// Returns the current token if it is a given keyword or punctuator.
+Token *peek(Reserved id) {
+  Token *tok = &tokens[pos];
+  if (tok->kind != TK_RESERVED || tok->id != id)
+    return NULL;
+  return tok;
+}
+
+// Consumes the current token if it is a given keyword or punctuator.
+Token *consume(Reserved id) {
+  if (!peek(id))
+    return NULL;
+  return &tokens[pos++];
+}
+
+Token *consume_ident(void) {
+  if (tokens[pos].kind != TK_IDENT)
+    return NULL;
+  return &tokens[pos++];
+}
+
+// If the next token is the symbol we expect,
+// consumes one token else reports an error.
+void expect(Reserved id) {
+    if (!peek(id)) {
+        error_tok(&tokens[pos], "next token is expected '%s'", reserved_str[id]);
+    }
+    pos++;
+}
+
+// If the next token  is a number,
+// consumes one token and return this number else reports an error
+long expect_number(void) {
+    if (tokens[pos].kind != TK_NUM) {
+        error_tok(&tokens[pos], "next token is expected a number");
+    }
+    long val = tokens[pos++].val;
+    return val;
+}
+
+char *expect_ident(void) {
+    if (tokens[pos].kind != TK_IDENT) {
+        error_tok(&tokens[pos], "expected an identifier");
+    }
+    return tokens[pos++].name;
+}
+
+bool at_eof(void) {
+    return tokens[pos].kind == TK_EOF;
+}
+
+// appends a new token to the token array. The pointer is valid until
+// the next token is added.
+Token *new_token(TokenKind kind, char *str, int len) {
+    if (num_tokens == cap_tokens) {
+        cap_tokens = cap_tokens ? cap_tokens * 2 : 4096;
+        tokens = realloc(tokens, sizeof(Token) * cap_tokens);
+    }
+    Token *tok = &tokens[num_tokens++];
+    memset(tok, 0, sizeof(Token));
+    tok->kind = kind;
+    tok->str = str;
+    tok->len = len;
+    return tok;
+}
+
+bool is_alpha(char c) {
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
+}
+
+bool is_alnum(char c) {
+    return is_alpha(c) || ('0' <= c && c <= '9');
+}
+
+static Reserved match(char *p, int len, char *kw, Reserved id) {
+    if (len == strlen(kw) && !memcmp(p, kw, len)) {
+        return id;
+    }
+    return NUM_RESERVED;
+}
+
+// Classifies an identifier-like word as a keyword by dispatching on
+// its first letter. Returns NUM_RESERVED for ordinary identifiers.
+Reserved keyword_id(char *p, int len) {
+    switch (*p) {
+    case '_': return match(p, len, "_Bool", KW_BOOL);
+    case 'c': return match(p, len, "char", KW_CHAR);
+    case 'e': return match(p, len, "else", KW_ELSE);
+    case 'f': return match(p, len, "for", KW_FOR);
+    case 'i':
+        if (len == 2) {
+            return match(p, len, "if", KW_IF);
+        }
+        return match(p, len, "int", KW_INT);
+    case 'l': return match(p, len, "long", KW_LONG);
+    case 'r': return match(p, len, "return", KW_RETURN);
+    case 's':
+        if (len == 5) {
+            return match(p, len, "short", KW_SHORT);
+        }
+        if (len > 1 && p[1] == 'i') {
+            return match(p, len, "sizeof", KW_SIZEOF);
+        }
+        return match(p, len, "struct", KW_STRUCT);
+    case 't': return match(p, len, "typedef", KW_TYPEDEF);
+    case 'v': return match(p, len, "void", KW_VOID);
+    case 'w': return match(p, len, "while", KW_WHILE);
+    }
+    return NUM_RESERVED;
+}
+
+// Reads a punctuator at `p` and returns its id and length,
+// or NUM_RESERVED if there is none.
+Reserved punct_id(char *p, int *len) {
+    *len = 1;
+    switch (*p) {
+    case '=':
+        if (p[1] == '=') {
+            *len = 2;
+            return PU_EQ;
+        }
+        return PU_ASSIGN;
+    case '!':
+        if (p[1] == '=') {
+            *len = 2;
+            return PU_NE;
+        }
+        return NUM_RESERVED;
+    case '<':
+        if (p[1] == '=') {
+            *len = 2;
+            return PU_LE;
+        }
+        return PU_LT;
+    case '>':
+        if (p[1] == '=') {
+            *len = 2;
+            return PU_GE;
+        }
+        return PU_GT;
+    case '-':
+        if (p[1] == '>') {
+            *len = 2;
+            return PU_ARROW;
+        }
+        return PU_MINUS;
+    case '+': return PU_PLUS;
+    case '*': return PU_STAR;
+    case '/': return PU_SLASH;
+    case '(': return PU_LPAREN;
+    case ')': return PU_RPAREN;
+    case ';': return PU_SEMI;
+    case '{': return PU_LBRACE;
+    case '}': return PU_RBRACE;
+    case ',': return PU_COMMA;
+    case '&': return PU_AMP;
+    case '[': return PU_LBRACKET;
+    case ']': return PU_RBRACKET;
+    case '.': return PU_DOT;
+    }
+    return NUM_RESERVED;
+}
+
+char get_escape_char(char c) {
+    switch (c)
+    {
+    case 'a': return '\a';
+    case 'b': return '\b';
+    case 't': return '\t';
+    case 'n': return '\n';
+    case 'v': return '\v';
+    case 'f': return '\f';
+    case 'r': return '\r';
+    case 'e': return 27;
+    case '0': return 0;
+    default: return c;
+    }
+}
+
+Token *read_string_literal(char *start){
+    char *p = start + 1;
+    char buf[1024];
+    int len = 0;
+
+    for (;;) {
+        if (len == sizeof(buf)) {
+            error_at(start, "string literal too large");
+        }
+        if (*p == '\0') {
+            error_at(start, "unclosed string literal");
+        }
+        if (*p == '"') {
+            break;
+        }
+
+        if (*p == '\\') {
+            p++;
+            buf[len++] = get_escape_char(*p++);
+        } else {
+            buf[len++] = *p++;
+        }
+    }
+
+    if (num_str_lits == cap_str_lits) {
+        cap_str_lits = cap_str_lits ? cap_str_lits * 2 : 256;
+        str_lits = realloc(str_lits, sizeof(StrLit) * cap_str_lits);
+    }
+    StrLit *lit = &str_lits[num_str_lits];
+    lit->contents = arena_alloc(&token_arena, len + 1);
+    memcpy(lit->contents, buf, len);
+    lit->contents[len] = '\0';
+    lit->len = len + 1;
+
+    Token *tok = new_token(TK_STR, start, p - start + 1);
+    tok->val = num_str_lits++;
+    return tok;
+}
+
+// tokenize input string and return the token array
+Token *tokenize(char *p) {
+    Token *cur;
+    num_tokens = 0;
+    num_str_lits = 0;
+
+    while (*p) {
+        // skip whitespace
+        if (isspace(*p)) {
+            p++;
+            continue;
+        }
+        // skip comment
+        if (strncmp(p, "//", 2) == 0) {
+            p += 2;
+            while (*p != '\n') {
+                p++;
+            }
+            continue;
+        }
+        // skip block comment
+        if (strncmp(p, "/*", 2) == 0) {
+            char *q = strstr(p + 2, "*/");
+            if (!q) {
+                error_at(p, "comment is not closd");
+            }
+            p = q + 2;
+            continue;
+        }
+
+        // Punctuator
+        int len;
+        Reserved id = punct_id(p, &len);
+        if (id != NUM_RESERVED) {
+            cur = new_token(TK_RESERVED, p, len);
+            cur->id = id;
+            p += len;
+            continue;
+        }
+
+        // Identifier multi letter
+        // rule 1: the first letter of an identifier does not a number
+        // rule 2: "_" is treated as an alphabet
+        // rule 3: after second letter, we can use alphabet and number
+
+        // check whether the first letter is alphabet
+        if (is_alpha(*p)) {
+            // The spelling is hashed while it is scanned (see hash_str).
+            char *q = p;
+            unsigned h = 2166136261u;
+            while (is_alnum(*p)) {
+                h = (h ^ (unsigned char)*p++) * 16777619u;
+            }
+            Reserved id = keyword_id(q, p - q);
+            if (id != NUM_RESERVED) {
+                cur = new_token(TK_RESERVED, q, p - q);
+                cur->id = id;
+            } else {
+                cur = new_token(TK_IDENT, q, p - q);
+                cur->name = intern(q, p - q, h);
+                cur->hash = h;
+            }
+            continue;
+        }
+
+        // String literal
+        if (*p == '"') {
+            cur = read_string_literal(p);
+            p += cur->len;
+            continue;
+        }
+
+        // Integer literal
+        if (isdigit(*p)) {
+            cur = new_token(TK_NUM, p, 0);
+            char *q = p;    // remain the head of Integer literal
+            cur->val = strtol(p, &p, 10);
+            cur->len = p - q;   // length of Integer
+            continue;
+        }
+
+        error_at(p, "invalid token");
+    }
+
+    new_token(TK_EOF, p, 0);
+    report_tokens(num_tokens);
+    pos = 0;
+    return tokens;
 }
\ No newline at end of file
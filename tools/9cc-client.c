@@ -0,0 +1,92 @@
+// Client for the compile server. `9cc-client <args>` behaves like
+// `9cc <args>` but hands the job to a running `9cc --server <socket>`.
+// The socket is taken from $NINECC_SERVER, or /tmp/9cc.sock by default.
+#define _DEFAULT_SOURCE
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static void fail(char *msg) {
+    fprintf(stderr, "9cc-client: %s: %s\n", msg, strerror(errno));
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    char *path = getenv("NINECC_SERVER");
+    if (!path) {
+        path = "/tmp/9cc.sock";
+    }
+
+    // The request: working directory and arguments, each ending in '\0'.
+    char cwd[4096];
+    if (!getcwd(cwd, sizeof(cwd))) {
+        fail("cannot get working directory");
+    }
+    size_t len = strlen(cwd) + 1;
+    for (int i = 1; i < argc; i++) {
+        len += strlen(argv[i]) + 1;
+    }
+    char *buf = malloc(len);
+    char *p = buf;
+    p = stpcpy(p, cwd) + 1;
+    for (int i = 1; i < argc; i++) {
+        p = stpcpy(p, argv[i]) + 1;
+    }
+
+    struct sockaddr_un addr = {AF_UNIX};
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        fail(path);
+    }
+    strcpy(addr.sun_path, path);
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0 || connect(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        fail(path);
+    }
+
+    // The length goes out together with our stdin, stdout and stderr.
+    uint32_t size = len;
+    struct iovec iov = {&size, sizeof(size)};
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(sizeof(int) * 3)];
+    } ctl;
+    memset(&ctl, 0, sizeof(ctl));
+    struct msghdr msg = {0};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = ctl.buf;
+    msg.msg_controllen = sizeof(ctl.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * 3);
+    int fds[3] = {0, 1, 2};
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    if (sendmsg(sock, &msg, 0) != sizeof(size)) {
+        fail("cannot send request");
+    }
+
+    for (p = buf; p < buf + len;) {
+        ssize_t n = write(sock, p, buf + len - p);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            fail("cannot send request");
+        }
+        p += n;
+    }
+
+    uint32_t status;
+    if (recv(sock, &status, sizeof(status), MSG_WAITALL) != sizeof(status)) {
+        fprintf(stderr, "9cc-client: server closed the connection\n");
+        return 1;
+    }
+    return status;
+}
@@ -1,75 +1,160 @@
-# include "9cc.h"
-
-char *strndup(char *str, int chars)
-{
-    char *buffer;
-    int n;
-
-    buffer = (char *) malloc(chars +1);
-    if (buffer)
-    {
-        for (n = 0; ((n < chars) && (str[n] != 0)) ; n++) buffer[n] = str[n];
-        buffer[n] = 0;
-    }
-
-    return buffer;
-}
-
-// reports an error and exit.
-// same args of printf()
-void error(char *fmt, ...) {
-    va_list ap;
-    va_start(ap, fmt);
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
-    exit(1);
-}
-
-// bool startswith(char *p, char *q) {
-//     return memcmp(p, q, strlen(q)) == 0;
-// }
-
-// bool is_alpha(char c) {
-//     return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
-// }
-
-// bool is_alnum(char c) {
-//     return is_alpha(c) || ('0' <= c && c <= '9');
-// }
-
-Vector *new_vec(void) {
-    Vector *v = malloc(sizeof(Vector));
-    v->data = malloc(sizeof(void *) * 16);
-    v->capacity = 16;
-    v->len = 0;
-    return v;
-}
-
-void vec_push(Vector *v, void *elem) {
-    if (v->len == v->capacity) {
-        v->capacity *= 2;
-        v->data = realloc(v->data, sizeof(void *) * v->capacity);
-    }
-    v->data[v->len++] = elem;
-}
-
-Map *new_map(void) {
-    Map *map = malloc(sizeof(Map));
-    map->keys = new_vec();
-    map->vals = new_vec();
-    return map;
-}
-
-void map_put(Map *map, char *key, void *val) {
-    vec_push(map->keys, key);
-    vec_push(map->vals, val);
-}
-
-void *map_get(Map *map, char *key) {
-    for (int i = map->keys->len - 1; i >= 0; i--) {
-        if (!strcmp(map->keys->data[i], key)) {
-            return map->vals->data[i];
-        }
-    }
-    return NULL;
+# include "9cc.h"
+
+// FNV-1a hash of the first `len` bytes of `str`.
+unsigned hash_str(char *str, int len) {
+    unsigned h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h = (h ^ (unsigned char)str[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Interned identifiers. Every distinct spelling is stored once, right
+// after its hash and length, so names can be compared by pointer and
+// their hash is available without rehashing.
+typedef struct {
+    unsigned hash;
+    int len;
+    char str[];
+} InternStr;
+
+static InternStr **intern_table;
+static int intern_cap;
+static int intern_used;
+
+static InternStr *header(char *name) {
+    return (InternStr *)(name - offsetof(InternStr, str));
+}
+
+unsigned name_hash(char *name) {
+    return header(name)->hash;
+}
+
+static void rehash(void) {
+    InternStr **old = intern_table;
+    int old_cap = intern_cap;
+
+    intern_cap = intern_cap ? intern_cap * 2 : 4096;
+    intern_table = calloc(intern_cap, sizeof(InternStr *));
+    for (int i = 0; i < old_cap; i++) {
+        if (!old[i]) {
+            continue;
+        }
+        int j = old[i]->hash & (intern_cap - 1);
+        while (intern_table[j]) {
+            j = (j + 1) & (intern_cap - 1);
+        }
+        intern_table[j] = old[i];
+    }
+    free(old);
+}
+
+// Returns the unique copy of the given spelling. `hash` must be
+// hash_str(str, len).
+char *intern(char *str, int len, unsigned hash) {
+    if (intern_used * 2 >= intern_cap) {
+        rehash();
+    }
+
+    int i = hash & (intern_cap - 1);
+    for (; intern_table[i]; i = (i + 1) & (intern_cap - 1)) {
+        InternStr *s = intern_table[i];
+        if (s->hash == hash && s->len == len && !memcmp(s->str, str, len)) {
+            return s->str;
+        }
+    }
+
+    InternStr *s = arena_alloc(&string_arena, sizeof(InternStr) + len + 1);
+    s->hash = hash;
+    s->len = len;
+    memcpy(s->str, str, len);
+    intern_table[i] = s;
+    intern_used++;
+    return s->str;
+}
+
+// Returns a newly allocated string formatted like sprintf().
+char *format(char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int len = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+
+    char *buf = arena_alloc(&node_arena, len + 1);
+    va_start(ap, fmt);
+    vsnprintf(buf, len + 1, fmt, ap);
+    va_end(ap);
+    return buf;
+}
+
+// Where errors unwind to instead of exiting, if set. The compile server
+// uses it to survive a failed job, and worker threads to report
+// failure to the main thread.
+_Thread_local jmp_buf *error_jmp;
+
+// Abandons the current compilation.
+void die(void) {
+    if (error_jmp) {
+        longjmp(*error_jmp, 1);
+    }
+    exit(1);
+}
+
+// reports an error and exit.
+// same args of printf()
+void error(char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    die();
+}
+
+// bool startswith(char *p, char *q) {
+//     return memcmp(p, q, strlen(q)) == 0;
+// }
+
+// bool is_alpha(char c) {
+//     return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
+// }
+
+// bool is_alnum(char c) {
+//     return is_alpha(c) || ('0' <= c && c <= '9');
+// }
+
+Vector *new_vec(void) {
+    Vector *v = malloc(sizeof(Vector));
+    v->data = malloc(sizeof(void *) * 16);
+    v->capacity = 16;
+    v->len = 0;
+    return v;
+}
+
+void vec_push(Vector *v, void *elem) {
+    if (v->len == v->capacity) {
+        v->capacity *= 2;
+        v->data = realloc(v->data, sizeof(void *) * v->capacity);
+    }
+    v->data[v->len++] = elem;
+}
+
+Map *new_map(void) {
+    Map *map = malloc(sizeof(Map));
+    map->keys = new_vec();
+    map->vals = new_vec();
+    return map;
+}
+
+void map_put(Map *map, char *key, void *val) {
+    vec_push(map->keys, key);
+    vec_push(map->vals, val);
+}
+
+void *map_get(Map *map, char *key) {
+    for (int i = map->keys->len - 1; i >= 0; i--) {
+        if (!strcmp(map->keys->data[i], key)) {
+            return map->vals->data[i];
+        }
+    }
+    return NULL;
 }
\ No newline at end of file